@@ -0,0 +1,266 @@
+/// @file FuraiEngine/Bit.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// ビット演算を提供します。
+#ifndef _FURAIENGINE_BIT_HPP
+#define _FURAIENGINE_BIT_HPP
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#include "FuraiEngine/Primitive.hpp"
+#if defined(FURAIENGINE_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(FURAIENGINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(FURAIENGINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 下位から連続する0のビット数を数えます。
+    /// @param value 対象の値です。
+    /// @return 連続する0のビット数です。値が0の場合、64です。
+    inline U32 CountTrailingZeros(U64 value) noexcept
+    {
+        if (value == 0)
+            return 64;
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return (U32) index;
+#else
+        return (U32) __builtin_ctzll(value);
+#endif
+    }
+
+    /// 上位から連続する0のビット数を数えます。
+    /// @param value 対象の値です。
+    /// @return 連続する0のビット数です。値が0の場合、64です。
+    inline U32 CountLeadingZeros(U64 value) noexcept
+    {
+        if (value == 0)
+            return 64;
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return (U32) (63 - index);
+#else
+        return (U32) __builtin_clzll(value);
+#endif
+    }
+
+    /// 1のビット数を数えます。
+    /// @param value 対象の値です。
+    /// @return 1のビット数です。
+    inline U32 PopCount(U64 value) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return (U32) __popcnt64(value);
+#else
+        return (U32) __builtin_popcountll(value);
+#endif
+    }
+
+    /// 指定値以上の最小の2の累乗を取得します。
+    /// @param value 対象の値です。
+    /// @return 2の累乗値です。値が0の場合、1です。
+    inline U64 NextPowerOfTwo(U64 value) noexcept
+    {
+        if (value <= 1)
+            return 1;
+        return (U64) 1 << (64 - CountLeadingZeros(value - 1));
+    }
+
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// ビット列の論理積を取ります。
+        /// @param pDestination 結果を格納するワード列です。
+        /// @param pSource 演算するワード列です。
+        /// @param count ワード数です。
+        inline void AndWords(U64       *pDestination,
+                             const U64 *pSource,
+                             USize      count) noexcept
+        {
+            USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+            for (; i + 2 <= count; i += 2)
+            {
+                auto d = _mm_loadu_si128((const __m128i *) &pDestination[i]);
+                auto s = _mm_loadu_si128((const __m128i *) &pSource[i]);
+                _mm_storeu_si128((__m128i *) &pDestination[i],
+                                 _mm_and_si128(d, s));
+            }
+#elif defined(FURAIENGINE_SIMD_NEON)
+            for (; i + 2 <= count; i += 2)
+                vst1q_u64(&pDestination[i],
+                          vandq_u64(vld1q_u64(&pDestination[i]),
+                                    vld1q_u64(&pSource[i])));
+#endif
+            for (; i < count; i++)
+                pDestination[i] &= pSource[i];
+        }
+
+        /// ビット列の論理和を取ります。
+        /// @param pDestination 結果を格納するワード列です。
+        /// @param pSource 演算するワード列です。
+        /// @param count ワード数です。
+        inline void OrWords(U64       *pDestination,
+                            const U64 *pSource,
+                            USize      count) noexcept
+        {
+            USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+            for (; i + 2 <= count; i += 2)
+            {
+                auto d = _mm_loadu_si128((const __m128i *) &pDestination[i]);
+                auto s = _mm_loadu_si128((const __m128i *) &pSource[i]);
+                _mm_storeu_si128((__m128i *) &pDestination[i],
+                                 _mm_or_si128(d, s));
+            }
+#elif defined(FURAIENGINE_SIMD_NEON)
+            for (; i + 2 <= count; i += 2)
+                vst1q_u64(&pDestination[i],
+                          vorrq_u64(vld1q_u64(&pDestination[i]),
+                                    vld1q_u64(&pSource[i])));
+#endif
+            for (; i < count; i++)
+                pDestination[i] |= pSource[i];
+        }
+
+        /// ビット列の排他的論理和を取ります。
+        /// @param pDestination 結果を格納するワード列です。
+        /// @param pSource 演算するワード列です。
+        /// @param count ワード数です。
+        inline void XorWords(U64       *pDestination,
+                             const U64 *pSource,
+                             USize      count) noexcept
+        {
+            USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+            for (; i + 2 <= count; i += 2)
+            {
+                auto d = _mm_loadu_si128((const __m128i *) &pDestination[i]);
+                auto s = _mm_loadu_si128((const __m128i *) &pSource[i]);
+                _mm_storeu_si128((__m128i *) &pDestination[i],
+                                 _mm_xor_si128(d, s));
+            }
+#elif defined(FURAIENGINE_SIMD_NEON)
+            for (; i + 2 <= count; i += 2)
+                vst1q_u64(&pDestination[i],
+                          veorq_u64(vld1q_u64(&pDestination[i]),
+                                    vld1q_u64(&pSource[i])));
+#endif
+            for (; i < count; i++)
+                pDestination[i] ^= pSource[i];
+        }
+
+        /// ビット列の1のビット数を数えます。
+        /// SSSE3が使用可能でPOPCNT命令が無い場合、4ビットごとの表引きで2ワードずつ数えます。
+        /// NEONの場合、バイトごとの数え上げ命令で2ワードずつ数えます。
+        /// POPCNT命令がある場合は1ワード1命令で数えられ表引きより速いため、
+        /// 4ワードずつ独立に数えて依存関係を断ち切るスカラー処理を使用します。
+        /// @param pWords ワード列です。
+        /// @param count ワード数です。
+        /// @return 1のビット数です。
+        inline USize PopCountWords(const U64 *pWords, USize count) noexcept
+        {
+            USize sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+            USize i    = 0;
+#if defined(FURAIENGINE_SIMD_SSSE3) && !defined(__POPCNT__)
+            const auto table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                             1, 2, 2, 3, 2, 3, 3, 4);
+            const auto lowMask = _mm_set1_epi8(0x0F);
+            auto       sums    = _mm_setzero_si128();
+            for (; i + 2 <= count; i += 2)
+            {
+                auto words = _mm_loadu_si128((const __m128i *) &pWords[i]);
+                auto low   = _mm_shuffle_epi8(table,
+                                            _mm_and_si128(words, lowMask));
+                auto high  = _mm_shuffle_epi8(
+                    table,
+                    _mm_and_si128(_mm_srli_epi16(words, 4), lowMask));
+                sums = _mm_add_epi64(
+                    sums,
+                    _mm_sad_epu8(_mm_add_epi8(low, high),
+                                 _mm_setzero_si128()));
+            }
+            alignas(16) U64 lanes[2];
+            _mm_store_si128((__m128i *) lanes, sums);
+            sum0 += (USize) lanes[0];
+            sum1 += (USize) lanes[1];
+#elif defined(FURAIENGINE_SIMD_NEON)
+            auto sums = vdupq_n_u64(0);
+            for (; i + 2 <= count; i += 2)
+                sums = vpadalq_u32(
+                    sums,
+                    vpaddlq_u16(vpaddlq_u8(vcntq_u8(
+                        vreinterpretq_u8_u64(vld1q_u64(&pWords[i]))))));
+            sum0 += (USize) vgetq_lane_u64(sums, 0);
+            sum1 += (USize) vgetq_lane_u64(sums, 1);
+#endif
+            for (; i + 4 <= count; i += 4)
+            {
+                sum0 += PopCount(pWords[i]);
+                sum1 += PopCount(pWords[i + 1]);
+                sum2 += PopCount(pWords[i + 2]);
+                sum3 += PopCount(pWords[i + 3]);
+            }
+            for (; i < count; i++)
+                sum0 += PopCount(pWords[i]);
+            return sum0 + sum1 + sum2 + sum3;
+        }
+
+        /// 指定位置以降で最初の1のビットを検索します。
+        /// @param pWords ワード列です。
+        /// @param count ワード数です。
+        /// @param from 検索を開始するビット位置です。
+        /// @return ビット位置です。見つからない場合、USIZE_MAXです。
+        inline USize
+        FindFirstSetWords(const U64 *pWords, USize count, USize from) noexcept
+        {
+            auto index = from / 64;
+            if (index >= count)
+                return USIZE_MAX;
+            auto word = pWords[index] & (~(U64) 0 << (from % 64));
+            while (word == 0)
+            {
+                index += 1;
+                if (index >= count)
+                    return USIZE_MAX;
+                word = pWords[index];
+            }
+            return index * 64 + CountTrailingZeros(word);
+        }
+
+        /// 指定範囲のビットを設定、または、解除します。
+        /// @param pWords ワード列です。
+        /// @param begin 範囲の先頭のビット位置です。
+        /// @param end 範囲の終端のビット位置です。(含みません)
+        /// @param value 設定する値です。
+        inline void
+        FillWords(U64 *pWords, USize begin, USize end, Bool value) noexcept
+        {
+            if (begin >= end)
+                return;
+            auto firstWord = begin / 64;
+            auto lastWord  = (end - 1) / 64;
+            auto firstMask = ~(U64) 0 << (begin % 64);
+            auto lastMask  = ~(U64) 0 >> (63 - (end - 1) % 64);
+            if (firstWord == lastWord)
+                firstMask &= lastMask;
+            pWords[firstWord] = value ? pWords[firstWord] | firstMask
+                                      : pWords[firstWord] & ~firstMask;
+            if (firstWord == lastWord)
+                return;
+            for (auto i = firstWord + 1; i < lastWord; i++)
+                pWords[i] = value ? ~(U64) 0 : 0;
+            pWords[lastWord] = value ? pWords[lastWord] | lastMask
+                                     : pWords[lastWord] & ~lastMask;
+        }
+    }
+    /// @endcond
+}
+#endif // !_FURAIENGINE_BIT_HPP
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define _FURAIENGINE_COLLECTIONS_ARRAY_HPP
 #include <initializer_list>
 #include <iterator>
+#include <new>
 #include "FuraiEngine/Memory.hpp"
 /// FuraiEngineのすべての機能を含む名前空間です。
 namespace FuraiEngine
@@ -15,6 +16,44 @@ namespace FuraiEngine
     class PointerIterator
     {
         T *m_pElement; // 現在位置の要素です。
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+        T *m_pBegin; // 範囲の先頭です。範囲が不明な場合、nullptrです。
+        T *m_pEnd;   // 範囲の終端です。
+#endif
+
+        /// 範囲を設定します。
+        /// @param pBegin 範囲の先頭です。
+        /// @param pEnd 範囲の終端です。
+        void _SetBounds([[maybe_unused]] T *pBegin,
+                        [[maybe_unused]] T *pEnd) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            this->m_pBegin = pBegin;
+            this->m_pEnd   = pEnd;
+#endif
+        }
+
+        /// 範囲をコピーします。
+        /// @param origin コピー元です。
+        void _CopyBounds([[maybe_unused]] const PointerIterator<T> &origin) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            this->m_pBegin = origin.m_pBegin;
+            this->m_pEnd   = origin.m_pEnd;
+#endif
+        }
+
+        /// 参照先を検査します。
+        /// @param signature 呼び出し元の関数のシグネチャです。
+        void _CheckElement([[maybe_unused]] const Char *signature) const noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            _Internal::CheckElement(this->m_pElement,
+                                    this->m_pBegin,
+                                    this->m_pEnd,
+                                    signature);
+#endif
+        }
 
     public:
         /// イテレータのカテゴリフラグ型です。
@@ -36,19 +75,35 @@ namespace FuraiEngine
         /// @param pointer メモリ上の現在地を指すポインタです。
         PointerIterator(T *pointer) noexcept
             : m_pElement(pointer)
-        {}
+        {
+            this->_SetBounds(nullptr, nullptr);
+        }
+
+        /// 範囲を指定して初期化します。
+        /// 境界検査が有効な場合、範囲外の参照を検出します。
+        /// @param pointer メモリ上の現在地を指すポインタです。
+        /// @param pBegin 範囲の先頭です。
+        /// @param pEnd 範囲の終端です。
+        PointerIterator(T *pointer, T *pBegin, T *pEnd) noexcept
+            : m_pElement(pointer)
+        {
+            this->_SetBounds(pBegin, pEnd);
+        }
 
         /// コピーします。
         /// @param origin コピー元です。
         PointerIterator(const PointerIterator<T> &origin) noexcept
             : m_pElement(origin.m_pElement)
-        {}
+        {
+            this->_CopyBounds(origin);
+        }
 
         /// ムーブします。
         /// @param origin ムーブ元です。
         PointerIterator(PointerIterator<T> &&origin) noexcept
             : m_pElement(origin.m_pElement)
         {
+            this->_CopyBounds(origin);
             origin.m_pElement = nullptr;
         }
 
@@ -58,6 +113,7 @@ namespace FuraiEngine
         operator=(const PointerIterator<T> &origin) noexcept
         {
             this->m_pElement = origin.m_pElement;
+            this->_CopyBounds(origin);
             return *this;
         }
 
@@ -67,6 +123,7 @@ namespace FuraiEngine
         {
             this->m_pElement  = origin.m_pElement;
             origin.m_pElement = nullptr;
+            this->_CopyBounds(origin);
             return *this;
         }
 
@@ -120,44 +177,20 @@ namespace FuraiEngine
 
         /// 要素にアクセスします。
         /// @return 要素の参照です。
-        /// @warning 参照先がヌルの場合、異常終了します。
+        /// @warning 境界検査が有効な場合、参照先がヌル、または、範囲外であれば異常終了します。
         T &operator*() noexcept
         {
-            if (this->m_pElement != nullptr)
-                return *this->m_pElement;
-            else
-            {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("参照先がnullでした。")
-                    .Write("'")
-                    .Write(typeid(T).name())
-                    .Write(" &PointerIterator<")
-                    .Write(typeid(T).name())
-                    .Write(">::operator*() noexcept'");
-
-                ExitError();
-            }
+            this->_CheckElement(TXT("T &PointerIterator<T>::operator*() noexcept"));
+            return *this->m_pElement;
         }
 
         /// 要素にアクセスします。
         /// @return 要素の参照です。
-        /// @warning 参照先がヌルの場合、異常終了します。
-        const T &operator*() const
+        /// @warning 境界検査が有効な場合、参照先がヌル、または、範囲外であれば異常終了します。
+        const T &operator*() const noexcept
         {
-            if (this->m_pElement != nullptr)
-                return *this->m_pElement;
-            else
-            {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("参照先がnullでした。")
-                    .Write("'const ")
-                    .Write(typeid(T).name())
-                    .Write(" &PointerIterator<")
-                    .Write(typeid(T).name())
-                    .Write(">::operator*() noexcept'");
-
-                ExitError();
-            }
+            this->_CheckElement(TXT("const T &PointerIterator<T>::operator*() const noexcept"));
+            return *this->m_pElement;
         }
 
         /// 要素が同等か比較します。
@@ -165,7 +198,7 @@ namespace FuraiEngine
         /// @return 同等の場合、真です。
         Bool operator==(const PointerIterator<T> &other) const noexcept
         {
-            return l.m_pElement == r.m_pElement;
+            return this->m_pElement == other.m_pElement;
         }
 
         /// 要素が不等か比較します。
@@ -173,7 +206,7 @@ namespace FuraiEngine
         /// @return 不等の場合、真です。
         Bool operator!=(const PointerIterator<T> &other) const noexcept
         {
-            return l.m_pElement != r.m_pElement;
+            return this->m_pElement != other.m_pElement;
         }
     };
 
@@ -181,7 +214,46 @@ namespace FuraiEngine
     template<typename T>
     class ConstPointerIterator
     {
-        T *m_pElement; // 現在位置の要素です。
+        const T *m_pElement; // 現在位置の要素です。
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+        const T *m_pBegin; // 範囲の先頭です。範囲が不明な場合、nullptrです。
+        const T *m_pEnd;   // 範囲の終端です。
+#endif
+
+        /// 範囲を設定します。
+        /// @param pBegin 範囲の先頭です。
+        /// @param pEnd 範囲の終端です。
+        void _SetBounds([[maybe_unused]] const T *pBegin,
+                        [[maybe_unused]] const T *pEnd) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            this->m_pBegin = pBegin;
+            this->m_pEnd   = pEnd;
+#endif
+        }
+
+        /// 範囲をコピーします。
+        /// @param origin コピー元です。
+        void _CopyBounds(
+            [[maybe_unused]] const ConstPointerIterator<T> &origin) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            this->m_pBegin = origin.m_pBegin;
+            this->m_pEnd   = origin.m_pEnd;
+#endif
+        }
+
+        /// 参照先を検査します。
+        /// @param signature 呼び出し元の関数のシグネチャです。
+        void _CheckElement([[maybe_unused]] const Char *signature) const noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK != FURAIENGINE_BOUNDS_CHECK_NONE
+            _Internal::CheckElement(this->m_pElement,
+                                    this->m_pBegin,
+                                    this->m_pEnd,
+                                    signature);
+#endif
+        }
 
     public:
         /// イテレータのカテゴリフラグ型です。
@@ -201,21 +273,37 @@ namespace FuraiEngine
 
         /// 初期化します。
         /// @param pointer メモリ上の現在地を指すポインタです。
-        ConstPointerIterator(T *pointer) noexcept
+        ConstPointerIterator(const T *pointer) noexcept
             : m_pElement(pointer)
-        {}
+        {
+            this->_SetBounds(nullptr, nullptr);
+        }
+
+        /// 範囲を指定して初期化します。
+        /// 境界検査が有効な場合、範囲外の参照を検出します。
+        /// @param pointer メモリ上の現在地を指すポインタです。
+        /// @param pBegin 範囲の先頭です。
+        /// @param pEnd 範囲の終端です。
+        ConstPointerIterator(const T *pointer, const T *pBegin, const T *pEnd) noexcept
+            : m_pElement(pointer)
+        {
+            this->_SetBounds(pBegin, pEnd);
+        }
 
         /// コピーします。
         /// @param origin コピー元です。
         ConstPointerIterator(const ConstPointerIterator<T> &origin) noexcept
             : m_pElement(origin.m_pElement)
-        {}
+        {
+            this->_CopyBounds(origin);
+        }
 
         /// ムーブします。
         /// @param origin ムーブ元です。
         ConstPointerIterator(ConstPointerIterator<T> &&origin) noexcept
             : m_pElement(origin.m_pElement)
         {
+            this->_CopyBounds(origin);
             origin.m_pElement = nullptr;
         }
 
@@ -225,6 +313,7 @@ namespace FuraiEngine
         operator=(const ConstPointerIterator<T> &origin) noexcept
         {
             this->m_pElement = origin.m_pElement;
+            this->_CopyBounds(origin);
             return *this;
         }
 
@@ -235,6 +324,7 @@ namespace FuraiEngine
         {
             this->m_pElement  = origin.m_pElement;
             origin.m_pElement = nullptr;
+            this->_CopyBounds(origin);
             return *this;
         }
 
@@ -288,22 +378,11 @@ namespace FuraiEngine
 
         /// 要素にアクセスします。
         /// @return 要素の参照です。
-        const T &operator*() const
+        /// @warning 境界検査が有効な場合、参照先がヌル、または、範囲外であれば異常終了します。
+        const T &operator*() const noexcept
         {
-            if (this->m_pElement != nullptr)
-                return *this->m_pElement;
-            else
-            {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("参照先がnullでした。")
-                    .Write("'const ")
-                    .Write(typeid(T).name())
-                    .Write(" &ConstPointerIterator<")
-                    .Write(typeid(T).name())
-                    .Write(">::operator*() noexcept'");
-
-                ExitError();
-            }
+            this->_CheckElement(TXT("const T &ConstPointerIterator<T>::operator*() const noexcept"));
+            return *this->m_pElement;
         }
 
         /// 要素が同等か比較します。
@@ -311,7 +390,7 @@ namespace FuraiEngine
         /// @return 同等の場合、真です。
         Bool operator==(const ConstPointerIterator<T> &other) const noexcept
         {
-            return l.m_pElement == r.m_pElement;
+            return this->m_pElement == other.m_pElement;
         }
 
         /// 要素が不等か比較します。
@@ -319,7 +398,7 @@ namespace FuraiEngine
         /// @return 不等の場合、真です。
         Bool operator!=(const ConstPointerIterator<T> &other) const noexcept
         {
-            return l.m_pElement != r.m_pElement;
+            return this->m_pElement != other.m_pElement;
         }
     };
 
@@ -362,13 +441,11 @@ namespace FuraiEngine
                      .Allocate(this->m_arraySize)
                      .IsSuccess(this->m_pArray))
             {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("メモリの確保に失敗しました。")
-                    .Write("'Array<")
-                    .Write(TypenameOf<T>())
-                    .Write(">::Array(USize size, const ")
-                    .Write(TypenameOf<AllocatorType>())
-                    .Write(" &allocator) noexcept'");
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'Array<{}>::Array(USize size, const {} "
+                             "&allocator) noexcept'"),
+                         TypenameOf<T>(),
+                         TypenameOf<AllocatorType>());
 
                 ExitError();
             }
@@ -387,13 +464,11 @@ namespace FuraiEngine
                      .Allocate(this->m_arraySize)
                      .IsSuccess(this->m_pArray))
             {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("メモリの確保に失敗しました。")
-                    .Write("'Array<")
-                    .Write(TypenameOf<T>())
-                    .Write(">::Array(const ")
-                    .Write(TypenameOf<AllocatorType>())
-                    .Write(" &allocator) noexcept'");
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'Array<{}>::Array(const {} &allocator) "
+                             "noexcept'"),
+                         TypenameOf<T>(),
+                         TypenameOf<AllocatorType>());
 
                 ExitError();
             }
@@ -403,7 +478,7 @@ namespace FuraiEngine
         /// @param list 初期化リストです。
         /// @param allocator アロケータです。
         /// @warning メモリ確保に失敗した場合、異常終了します。
-        Array(std::initializer_list<T> &list,
+        Array(std::initializer_list<T> list,
               const AllocatorType &allocator = AllocatorType())
             : m_arraySize(
                 (list.size() < ARRAY_SIZE_MIN ? ARRAY_SIZE_MIN : list.size()))
@@ -415,27 +490,417 @@ namespace FuraiEngine
                      .Allocate(this->m_arraySize)
                      .IsSuccess(this->m_pArray))
             {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write("メモリの確保に失敗しました。")
-                    .Write("'Array<")
-                    .Write(TypenameOf<T>())
-                    .Write(
-                        ">::Array(std::initializer_list "
-                        "&list, const ")
-                    .Write(TypenameOf<AllocatorType>())
-                    .Write(" &allocator) noexcept'");
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'Array<{}>::Array(std::initializer_list &list, "
+                             "const {} &allocator) noexcept'"),
+                         TypenameOf<T>(),
+                         TypenameOf<AllocatorType>());
 
                 ExitError();
             }
 
             // 挿入します。
-            USize i = 0;
             for (auto itr = list.begin(); itr != list.end(); ++itr)
             {
-                this->m_pArray[i] = *itr;
-                i += 1;
+                new (&this->m_pArray[this->m_elementsCount]) T(*itr);
+                this->m_elementsCount += 1;
+            }
+        }
+
+        /// コピーします。
+        /// @param origin コピー元です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        Array(const Array<T, A> &origin) noexcept
+            : m_arraySize(origin.m_elementsCount < ARRAY_SIZE_MIN
+                              ? ARRAY_SIZE_MIN
+                              : origin.m_elementsCount)
+            , m_elementsCount(0)
+            , m_allocator(origin.m_allocator)
+            , m_pArray(nullptr)
+        {
+            if (!this->m_allocator
+                     .Allocate(this->m_arraySize)
+                     .IsSuccess(this->m_pArray))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'Array<{}>::Array(const Array &origin) "
+                             "noexcept'"),
+                         TypenameOf<T>());
+
+                ExitError();
+            }
+
+            for (USize i = 0; i < origin.m_elementsCount; i++)
+                new (&this->m_pArray[i]) T(origin.m_pArray[i]);
+            this->m_elementsCount = origin.m_elementsCount;
+        }
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        Array(Array<T, A> &&origin) noexcept
+            : m_arraySize(origin.m_arraySize)
+            , m_elementsCount(origin.m_elementsCount)
+            , m_allocator(Move(origin.m_allocator))
+            , m_pArray(origin.m_pArray)
+        {
+            origin.m_arraySize     = 0;
+            origin.m_elementsCount = 0;
+            origin.m_pArray        = nullptr;
+        }
+
+        /// コピー代入します。
+        /// @param origin コピー元です。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        Array<T, A> &operator=(const Array<T, A> &origin) noexcept
+        {
+            if (this != &origin)
+            {
+                this->Clear();
+                this->Reserve(origin.m_elementsCount);
+                for (USize i = 0; i < origin.m_elementsCount; i++)
+                    new (&this->m_pArray[i]) T(origin.m_pArray[i]);
+                this->m_elementsCount = origin.m_elementsCount;
+            }
+            return *this;
+        }
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        Array<T, A> &operator=(Array<T, A> &&origin) noexcept
+        {
+            if (this != &origin)
+            {
+                this->_Release();
+                this->m_arraySize      = origin.m_arraySize;
+                this->m_elementsCount  = origin.m_elementsCount;
+                this->m_allocator      = Move(origin.m_allocator);
+                this->m_pArray         = origin.m_pArray;
+                origin.m_arraySize     = 0;
+                origin.m_elementsCount = 0;
+                origin.m_pArray        = nullptr;
+            }
+            return *this;
+        }
+
+        /// 解体します。
+        ~Array() noexcept
+        {
+            this->_Release();
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_elementsCount;
+        }
+
+        /// 配列長を取得します。
+        /// @return 拡張せずに保持できる要素数です。
+        USize Capacity() const noexcept
+        {
+            return this->m_arraySize;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_elementsCount == 0;
+        }
+
+        /// 先頭要素のポインタを取得します。
+        /// @return 先頭要素のポインタです。
+        ElementType *Data() noexcept
+        {
+            return this->m_pArray;
+        }
+
+        /// 先頭要素のポインタを取得します。
+        /// @return 先頭要素のポインタです。
+        const ElementType *Data() const noexcept
+        {
+            return this->m_pArray;
+        }
+
+        /// 要素にアクセスします。
+        /// @param index 要素の位置です。
+        /// @return 要素の参照です。
+        ElementType &operator[](USize index) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_elementsCount,
+                TXT("T &Array<T, A>::operator[](USize index) noexcept"));
+            return this->m_pArray[index];
+        }
+
+        /// 要素にアクセスします。
+        /// @param index 要素の位置です。
+        /// @return 要素の参照です。
+        const ElementType &operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_elementsCount,
+                TXT("const T &Array<T, A>::operator[](USize index) const "
+                    "noexcept"));
+            return this->m_pArray[index];
+        }
+
+        /// 指定要素数を拡張せずに保持できるよう配列長を確保します。
+        /// @param count 要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            if (count > this->m_arraySize)
+                this->_Reallocate(count);
+        }
+
+        /// 要素数を変更します。増えた要素は指定値で初期化します。
+        /// @param count 新しい要素数です。
+        /// @param value 増えた要素の値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Resize(USize                count,
+                    const ElementType &value = ElementType()) noexcept
+        {
+            if (count > this->m_arraySize)
+            {
+                // 値が自身の要素を参照する場合に備え、拡張する前に複製します
+                ElementType copied(value);
+                this->_Reallocate(count);
+                this->Resize(count, copied);
+                return;
+            }
+            while (this->m_elementsCount > count)
+                this->RemoveLast();
+            while (this->m_elementsCount < count)
+            {
+                new (&this->m_pArray[this->m_elementsCount]) T(value);
+                this->m_elementsCount += 1;
             }
         }
+
+        /// 末尾に要素を追加します。
+        /// @param value 追加する要素です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Add(const ElementType &value) noexcept
+        {
+            this->_AddLast(value);
+        }
+
+        /// 末尾に要素を追加します。
+        /// @param value 追加する要素です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Add(ElementType &&value) noexcept
+        {
+            this->_AddLast(Move(value));
+        }
+
+        /// 指定位置に要素を挿入します。以降の要素は後ろにずれます。
+        /// @param index 挿入する位置です。
+        /// @param value 挿入する要素です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Insert(USize index, ElementType &&value) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_elementsCount + 1,
+                TXT("void Array<T, A>::Insert(USize index, T &&value) "
+                    "noexcept"));
+            this->_PrepareAdd();
+            if (index == this->m_elementsCount)
+            {
+                new (&this->m_pArray[index]) T(Move(value));
+            }
+            else
+            {
+                auto last = this->m_elementsCount - 1;
+                new (&this->m_pArray[last + 1]) T(Move(this->m_pArray[last]));
+                for (USize i = last; i > index; i--)
+                    this->m_pArray[i] = Move(this->m_pArray[i - 1]);
+                this->m_pArray[index] = Move(value);
+            }
+            this->m_elementsCount += 1;
+        }
+
+        /// 指定位置の要素を削除します。以降の要素は前にずれます。
+        /// @param index 削除する位置です。
+        void RemoveAt(USize index) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_elementsCount,
+                TXT("void Array<T, A>::RemoveAt(USize index) noexcept"));
+            for (USize i = index + 1; i < this->m_elementsCount; i++)
+                this->m_pArray[i - 1] = Move(this->m_pArray[i]);
+            this->m_elementsCount -= 1;
+            this->m_pArray[this->m_elementsCount].~T();
+        }
+
+        /// 指定位置の要素を末尾の要素と入れ替えて削除します。
+        /// 要素の順序は保たれませんが、要素をずらしません。
+        /// @param index 削除する位置です。
+        void RemoveAtSwapLast(USize index) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_elementsCount,
+                TXT("void Array<T, A>::RemoveAtSwapLast(USize index) "
+                    "noexcept"));
+            this->m_elementsCount -= 1;
+            if (index != this->m_elementsCount)
+                this->m_pArray[index] =
+                    Move(this->m_pArray[this->m_elementsCount]);
+            this->m_pArray[this->m_elementsCount].~T();
+        }
+
+        /// 末尾の要素を削除します。
+        void RemoveLast() noexcept
+        {
+            _Internal::CheckIndex(
+                0,
+                this->m_elementsCount,
+                TXT("void Array<T, A>::RemoveLast() noexcept"));
+            this->m_elementsCount -= 1;
+            this->m_pArray[this->m_elementsCount].~T();
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            for (USize i = 0; i < this->m_elementsCount; i++)
+                this->m_pArray[i].~T();
+            this->m_elementsCount = 0;
+        }
+
+        /// 先頭のイテレータを取得します。
+        /// @return 先頭のイテレータです。
+        IteratorType begin() noexcept
+        {
+            return IteratorType(this->m_pArray,
+                                this->m_pArray,
+                                this->m_pArray + this->m_elementsCount);
+        }
+
+        /// 終端のイテレータを取得します。
+        /// @return 終端のイテレータです。
+        IteratorType end() noexcept
+        {
+            return IteratorType(this->m_pArray + this->m_elementsCount,
+                                this->m_pArray,
+                                this->m_pArray + this->m_elementsCount);
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return ConstIteratorType(this->m_pArray,
+                                     this->m_pArray,
+                                     this->m_pArray + this->m_elementsCount);
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return ConstIteratorType(this->m_pArray + this->m_elementsCount,
+                                     this->m_pArray,
+                                     this->m_pArray + this->m_elementsCount);
+        }
+
+    private:
+        /// 配列長を変更し、要素を移動します。
+        /// @param size 新しい配列長です。
+        void _Reallocate(USize size) noexcept
+        {
+            this->_MoveElements(this->_AllocateArray(size), size);
+        }
+
+        /// 新しい配列を確保します。
+        /// @param size 配列長です。
+        /// @return 確保した配列です。
+        ElementType *_AllocateArray(USize size) noexcept
+        {
+            ElementType *pArray = nullptr;
+            if (!this->m_allocator.Allocate(size).IsSuccess(pArray))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'Array<{}>::_AllocateArray(USize size) noexcept'"),
+                         TypenameOf<T>());
+
+                ExitError();
+            }
+            return pArray;
+        }
+
+        /// 要素を新しい配列へ移動し、古い配列を解放します。
+        /// @param pArray 新しい配列です。
+        /// @param size 新しい配列長です。
+        void _MoveElements(ElementType *pArray, USize size) noexcept
+        {
+            for (USize i = 0; i < this->m_elementsCount; i++)
+            {
+                new (&pArray[i]) T(Move(this->m_pArray[i]));
+                this->m_pArray[i].~T();
+            }
+            if (this->m_pArray != nullptr)
+                static_cast<void>(this->m_allocator.Deallocate(
+                    this->m_pArray, this->m_arraySize));
+            this->m_pArray    = pArray;
+            this->m_arraySize = size;
+        }
+
+        /// 拡張後の配列長を取得します。
+        /// @return 拡張後の配列長です。
+        USize _GrownSize() const noexcept
+        {
+            return this->m_arraySize < ARRAY_SIZE_MIN ? ARRAY_SIZE_MIN
+                                                      : this->m_arraySize * 2;
+        }
+
+        /// 要素を1つ追加できるように必要なら拡張します。
+        void _PrepareAdd() noexcept
+        {
+            if (this->m_elementsCount < this->m_arraySize)
+                return;
+            this->_Reallocate(this->_GrownSize());
+        }
+
+        /// 末尾に要素を追加します。
+        /// 拡張する場合は古い要素を移動する前に新しい配列へ構築するため、値が自身の要素を参照していても構いません。
+        /// @tparam U 値の型です。
+        /// @param value 追加する要素です。
+        template<typename U>
+        void _AddLast(U &&value) noexcept
+        {
+            if (this->m_elementsCount < this->m_arraySize)
+            {
+                new (&this->m_pArray[this->m_elementsCount]) T(Forward<U>(value));
+                this->m_elementsCount += 1;
+                return;
+            }
+            auto size   = this->_GrownSize();
+            auto pArray = this->_AllocateArray(size);
+            new (&pArray[this->m_elementsCount]) T(Forward<U>(value));
+            this->_MoveElements(pArray, size);
+            this->m_elementsCount += 1;
+        }
+
+        /// 全要素を解体し、メモリを解放します。
+        void _Release() noexcept
+        {
+            if (this->m_pArray == nullptr)
+                return;
+            this->Clear();
+            static_cast<void>(this->m_allocator.Deallocate(
+                this->m_pArray, this->m_arraySize));
+            this->m_pArray    = nullptr;
+            this->m_arraySize = 0;
+        }
     };
 }
 #endif // !_FURAIENGINE_COLLECTIONS_ARRAY_HPP
\ No newline at end of file
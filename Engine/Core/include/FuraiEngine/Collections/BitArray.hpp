@@ -0,0 +1,251 @@
+/// @file FuraiEngine/Collections/BitArray.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 動的ビット配列を提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_BITARRAY_HPP
+#define _FURAIENGINE_COLLECTIONS_BITARRAY_HPP
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Collections/Array.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 動的ビット配列です。
+    /// 1要素を1ビットで64ビットワードに詰めて保持します。
+    /// 末尾ワードの範囲外ビットは常に0に保たれます。
+    /// @tparam A ワード配列のアロケータの型です。
+    template<typename A = Allocator<U64>>
+    class BitArray
+    {
+        Array<U64, A> m_words;     // ビットを格納するワード配列です。
+        USize         m_bitsCount; // ビット数です。
+
+        /// ビット数から必要なワード数を計算します。
+        /// @param count ビット数です。
+        /// @return ワード数です。
+        static USize _WordsCountOf(USize count) noexcept
+        {
+            return (count + 63) / 64;
+        }
+
+        /// 末尾ワードの範囲外ビットを0にします。
+        void _ClearUnusedBits() noexcept
+        {
+            auto rest = this->m_bitsCount % 64;
+            if (rest != 0)
+                this->m_words[this->m_words.Count() - 1] &=
+                    ~(U64) 0 >> (64 - rest);
+        }
+
+    public:
+        /// ビット数を指定して初期化します。
+        /// @param count ビット数です。
+        /// @param value 全ビットの初期値です。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        BitArray(USize    count     = 0,
+                 Bool     value     = false,
+                 const A &allocator = A()) noexcept
+            : m_words(_WordsCountOf(count), allocator)
+            , m_bitsCount(count)
+        {
+            this->m_words.Resize(_WordsCountOf(count), value ? ~(U64) 0 : 0);
+            this->_ClearUnusedBits();
+        }
+
+        /// ビット数を取得します。
+        /// @return ビット数です。
+        USize Count() const noexcept
+        {
+            return this->m_bitsCount;
+        }
+
+        /// ワード配列を取得します。
+        /// @return ワード配列です。
+        const Array<U64, A> &Words() const noexcept
+        {
+            return this->m_words;
+        }
+
+        /// ビット数を変更します。
+        /// @param count 新しいビット数です。
+        /// @param value 増えたビットの値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Resize(USize count, Bool value = false) noexcept
+        {
+            auto oldCount = this->m_bitsCount;
+            this->m_words.Resize(_WordsCountOf(count), value ? ~(U64) 0 : 0);
+            this->m_bitsCount = count;
+            if (value && count > oldCount)
+                _Internal::FillWords(this->m_words.Data(),
+                                     oldCount,
+                                     count,
+                                     true);
+            this->_ClearUnusedBits();
+        }
+
+        /// ビットを取得します。
+        /// @param index ビット位置です。
+        /// @return ビットの値です。
+        Bool Get(USize index) const noexcept
+        {
+            return (this->m_words[index / 64] >> (index % 64)) & 1;
+        }
+
+        /// ビットを取得します。
+        /// @param index ビット位置です。
+        /// @return ビットの値です。
+        Bool operator[](USize index) const noexcept
+        {
+            return this->Get(index);
+        }
+
+        /// ビットを1にします。
+        /// @param index ビット位置です。
+        void Set(USize index) noexcept
+        {
+            this->m_words[index / 64] |= (U64) 1 << (index % 64);
+        }
+
+        /// ビットを設定します。
+        /// @param index ビット位置です。
+        /// @param value 設定する値です。
+        void Set(USize index, Bool value) noexcept
+        {
+            auto mask = (U64) 1 << (index % 64);
+            auto &word = this->m_words[index / 64];
+            word       = (word & ~mask) | (value ? mask : 0);
+        }
+
+        /// ビットを0にします。
+        /// @param index ビット位置です。
+        void Reset(USize index) noexcept
+        {
+            this->m_words[index / 64] &= ~((U64) 1 << (index % 64));
+        }
+
+        /// ビットを反転します。
+        /// @param index ビット位置です。
+        void Flip(USize index) noexcept
+        {
+            this->m_words[index / 64] ^= (U64) 1 << (index % 64);
+        }
+
+        /// 範囲のビットを1にします。
+        /// @param begin 範囲の先頭です。
+        /// @param end 範囲の終端です。(含みません)
+        void SetRange(USize begin, USize end) noexcept
+        {
+            _Internal::CheckRange(
+                begin,
+                end - begin,
+                this->m_bitsCount,
+                TXT("void BitArray<A>::SetRange(USize begin, USize end) noexcept"));
+            _Internal::FillWords(this->m_words.Data(), begin, end, true);
+        }
+
+        /// 範囲のビットを0にします。
+        /// @param begin 範囲の先頭です。
+        /// @param end 範囲の終端です。(含みません)
+        void ResetRange(USize begin, USize end) noexcept
+        {
+            _Internal::CheckRange(
+                begin,
+                end - begin,
+                this->m_bitsCount,
+                TXT("void BitArray<A>::ResetRange(USize begin, USize end) noexcept"));
+            _Internal::FillWords(this->m_words.Data(), begin, end, false);
+        }
+
+        /// 全ビットを1にします。
+        void SetAll() noexcept
+        {
+            this->SetRange(0, this->m_bitsCount);
+        }
+
+        /// 全ビットを0にします。
+        void ResetAll() noexcept
+        {
+            this->ResetRange(0, this->m_bitsCount);
+        }
+
+        /// 1のビット数を数えます。
+        /// @return 1のビット数です。
+        USize PopCount() const noexcept
+        {
+            return _Internal::PopCountWords(this->m_words.Data(),
+                                            this->m_words.Count());
+        }
+
+        /// 1のビットが存在するか判定します。
+        /// @return 存在する場合、真です。
+        Bool Any() const noexcept
+        {
+            return this->FindFirstSet() != USIZE_MAX;
+        }
+
+        /// 指定位置以降で最初の1のビットを検索します。
+        /// @param from 検索を開始するビット位置です。
+        /// @return ビット位置です。見つからない場合、USIZE_MAXです。
+        USize FindFirstSet(USize from = 0) const noexcept
+        {
+            return _Internal::FindFirstSetWords(this->m_words.Data(),
+                                                this->m_words.Count(),
+                                                from);
+        }
+
+        /// 1のビットの位置を順に関数に渡します。
+        /// @param func ビット位置を受け取る関数です。
+        template<typename F>
+        void ForEachSet(F &&func) const noexcept
+        {
+            auto pWords = this->m_words.Data();
+            for (USize i = 0; i < this->m_words.Count(); i++)
+            {
+                for (auto word = pWords[i]; word != 0; word &= word - 1)
+                    func(i * 64 + CountTrailingZeros(word));
+            }
+        }
+
+        /// 論理積を取ります。ビット数は同じである必要があります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitArray<A> &operator&=(const BitArray<A> &other) noexcept
+        {
+            _Internal::AndWords(this->m_words.Data(),
+                                other.m_words.Data(),
+                                this->m_words.Count());
+            return *this;
+        }
+
+        /// 論理和を取ります。ビット数は同じである必要があります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitArray<A> &operator|=(const BitArray<A> &other) noexcept
+        {
+            _Internal::OrWords(this->m_words.Data(),
+                               other.m_words.Data(),
+                               this->m_words.Count());
+            return *this;
+        }
+
+        /// 排他的論理和を取ります。ビット数は同じである必要があります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitArray<A> &operator^=(const BitArray<A> &other) noexcept
+        {
+            _Internal::XorWords(this->m_words.Data(),
+                                other.m_words.Data(),
+                                this->m_words.Count());
+            return *this;
+        }
+
+        /// 全ビットを反転します。
+        void FlipAll() noexcept
+        {
+            for (USize i = 0; i < this->m_words.Count(); i++)
+                this->m_words[i] = ~this->m_words[i];
+            this->_ClearUnusedBits();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_BITARRAY_HPP
\ No newline at end of file
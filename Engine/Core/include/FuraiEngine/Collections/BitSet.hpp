@@ -0,0 +1,237 @@
+/// @file FuraiEngine/Collections/BitSet.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 固定長ビット集合を提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_BITSET_HPP
+#define _FURAIENGINE_COLLECTIONS_BITSET_HPP
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Utility.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 固定長ビット集合です。
+    /// メモリ確保を行わず、ワード列を内部に保持します。
+    /// 末尾ワードの範囲外ビットは常に0に保たれます。
+    /// @tparam N ビット数です。
+    template<USize N>
+    class BitSet
+    {
+        static_assert(N > 0, "BitSet<N>のNは1以上である必要があります。");
+
+    public:
+        /// ワード数です。
+        static constexpr USize WORDS_COUNT = (N + 63) / 64;
+
+    private:
+        U64 m_words[WORDS_COUNT]; // ビットを格納するワード列です。
+
+        /// 末尾ワードの範囲外ビットを0にします。
+        void _ClearUnusedBits() noexcept
+        {
+            if (N % 64 != 0)
+                this->m_words[WORDS_COUNT - 1] &= ~(U64) 0 >> (64 - N % 64);
+        }
+
+    public:
+        /// 初期化します。
+        /// @param value 全ビットの初期値です。
+        BitSet(Bool value = false) noexcept
+        {
+            for (USize i = 0; i < WORDS_COUNT; i++)
+                this->m_words[i] = value ? ~(U64) 0 : 0;
+            this->_ClearUnusedBits();
+        }
+
+        /// ビット数を取得します。
+        /// @return ビット数です。
+        constexpr USize Count() const noexcept
+        {
+            return N;
+        }
+
+        /// ワード列を取得します。
+        /// @return ワード列の先頭です。要素数はWORDS_COUNTです。
+        const U64 *Words() const noexcept
+        {
+            return this->m_words;
+        }
+
+        /// ビットを取得します。
+        /// @param index ビット位置です。
+        /// @return ビットの値です。
+        Bool Get(USize index) const noexcept
+        {
+            return (this->m_words[index / 64] >> (index % 64)) & 1;
+        }
+
+        /// ビットを取得します。
+        /// @param index ビット位置です。
+        /// @return ビットの値です。
+        Bool operator[](USize index) const noexcept
+        {
+            return this->Get(index);
+        }
+
+        /// ビットを1にします。
+        /// @param index ビット位置です。
+        void Set(USize index) noexcept
+        {
+            this->m_words[index / 64] |= (U64) 1 << (index % 64);
+        }
+
+        /// ビットを設定します。
+        /// @param index ビット位置です。
+        /// @param value 設定する値です。
+        void Set(USize index, Bool value) noexcept
+        {
+            auto  mask = (U64) 1 << (index % 64);
+            auto &word = this->m_words[index / 64];
+            word       = (word & ~mask) | (value ? mask : 0);
+        }
+
+        /// ビットを0にします。
+        /// @param index ビット位置です。
+        void Reset(USize index) noexcept
+        {
+            this->m_words[index / 64] &= ~((U64) 1 << (index % 64));
+        }
+
+        /// ビットを反転します。
+        /// @param index ビット位置です。
+        void Flip(USize index) noexcept
+        {
+            this->m_words[index / 64] ^= (U64) 1 << (index % 64);
+        }
+
+        /// 範囲のビットを1にします。
+        /// @param begin 範囲の先頭です。
+        /// @param end 範囲の終端です。(含みません)
+        void SetRange(USize begin, USize end) noexcept
+        {
+            _Internal::CheckRange(
+                begin,
+                end - begin,
+                N,
+                TXT("void BitSet<N>::SetRange(USize begin, USize end) noexcept"));
+            _Internal::FillWords(this->m_words, begin, end, true);
+        }
+
+        /// 範囲のビットを0にします。
+        /// @param begin 範囲の先頭です。
+        /// @param end 範囲の終端です。(含みません)
+        void ResetRange(USize begin, USize end) noexcept
+        {
+            _Internal::CheckRange(
+                begin,
+                end - begin,
+                N,
+                TXT("void BitSet<N>::ResetRange(USize begin, USize end) noexcept"));
+            _Internal::FillWords(this->m_words, begin, end, false);
+        }
+
+        /// 全ビットを1にします。
+        void SetAll() noexcept
+        {
+            this->SetRange(0, N);
+        }
+
+        /// 全ビットを0にします。
+        void ResetAll() noexcept
+        {
+            this->ResetRange(0, N);
+        }
+
+        /// 1のビット数を数えます。
+        /// @return 1のビット数です。
+        USize PopCount() const noexcept
+        {
+            return _Internal::PopCountWords(this->m_words, WORDS_COUNT);
+        }
+
+        /// 1のビットが存在するか判定します。
+        /// @return 存在する場合、真です。
+        Bool Any() const noexcept
+        {
+            return this->FindFirstSet() != USIZE_MAX;
+        }
+
+        /// 指定位置以降で最初の1のビットを検索します。
+        /// @param from 検索を開始するビット位置です。
+        /// @return ビット位置です。見つからない場合、USIZE_MAXです。
+        USize FindFirstSet(USize from = 0) const noexcept
+        {
+            return _Internal::FindFirstSetWords(this->m_words,
+                                                WORDS_COUNT,
+                                                from);
+        }
+
+        /// 1のビットの位置を順に関数に渡します。
+        /// @param func ビット位置を受け取る関数です。
+        template<typename F>
+        void ForEachSet(F &&func) const noexcept
+        {
+            for (USize i = 0; i < WORDS_COUNT; i++)
+            {
+                for (auto word = this->m_words[i]; word != 0; word &= word - 1)
+                    func(i * 64 + CountTrailingZeros(word));
+            }
+        }
+
+        /// 論理積を取ります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitSet<N> &operator&=(const BitSet<N> &other) noexcept
+        {
+            _Internal::AndWords(this->m_words, other.m_words, WORDS_COUNT);
+            return *this;
+        }
+
+        /// 論理和を取ります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitSet<N> &operator|=(const BitSet<N> &other) noexcept
+        {
+            _Internal::OrWords(this->m_words, other.m_words, WORDS_COUNT);
+            return *this;
+        }
+
+        /// 排他的論理和を取ります。
+        /// @param other 演算対象です。
+        /// @return 自身のインスタンスです。
+        BitSet<N> &operator^=(const BitSet<N> &other) noexcept
+        {
+            _Internal::XorWords(this->m_words, other.m_words, WORDS_COUNT);
+            return *this;
+        }
+
+        /// 全ビットを反転します。
+        void FlipAll() noexcept
+        {
+            for (USize i = 0; i < WORDS_COUNT; i++)
+                this->m_words[i] = ~this->m_words[i];
+            this->_ClearUnusedBits();
+        }
+
+        /// 等価比較します。
+        /// @param other 比較対象です。
+        /// @return 全ビットが等しい場合、真です。
+        Bool operator==(const BitSet<N> &other) const noexcept
+        {
+            for (USize i = 0; i < WORDS_COUNT; i++)
+            {
+                if (this->m_words[i] != other.m_words[i])
+                    return false;
+            }
+            return true;
+        }
+
+        /// 非等価比較します。
+        /// @param other 比較対象です。
+        /// @return いずれかのビットが異なる場合、真です。
+        Bool operator!=(const BitSet<N> &other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_BITSET_HPP
\ No newline at end of file
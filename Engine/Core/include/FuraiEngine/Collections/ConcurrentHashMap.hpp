@@ -0,0 +1,670 @@
+/// @file FuraiEngine/Collections/ConcurrentHashMap.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// スレッド安全なハッシュマップを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_CONCURRENTHASHMAP_HPP
+#define _FURAIENGINE_COLLECTIONS_CONCURRENTHASHMAP_HPP
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Collections/Array.hpp"
+#include "FuraiEngine/Hash.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// ConcurrentHashMapの要素のノードです。
+        /// 挿入後は移動せず、値も変更されません。
+        /// @tparam K キーの型です。
+        /// @tparam V 値の型です。
+        template<typename K, typename V>
+        class ConcurrentHashMapNode
+        {
+        public:
+            /// 攪拌済みのハッシュ値です。
+            U64 hash;
+            /// キーです。
+            K key;
+            /// 値です。
+            V value;
+
+            /// 初期化します。
+            /// @param hash 攪拌済みのハッシュ値です。
+            /// @param key キーです。
+            /// @param value 値です。
+            template<typename KK, typename VV>
+            ConcurrentHashMapNode(U64 hash, KK &&key, VV &&value) noexcept
+                : hash(hash)
+                , key(Forward<KK>(key))
+                , value(Forward<VV>(value))
+            {}
+        };
+
+        /// ConcurrentHashMapのシャードが保持する線形探索テーブルです。
+        /// 読み取り側はロックせずにスロットを読みます。
+        /// @tparam N ノードの型です。
+        template<typename N>
+        class ConcurrentHashMapTable
+        {
+        public:
+            /// 削除済みスロットを表す値です。
+            static N *Tombstone() noexcept
+            {
+                return (N *) (USize) 1;
+            }
+
+            /// スロット数です。(2の累乗)
+            USize capacity;
+            /// 使用中、または、削除済みのスロット数です。
+            USize usedCount;
+            /// スロット配列です。
+            std::atomic<N *> *pSlots;
+        };
+
+        /// 解放を遅延しているポインタです。
+        /// @tparam P ポインタが指す型です。
+        template<typename P>
+        class ConcurrentHashMapRetired
+        {
+        public:
+            /// 解放するポインタです。
+            P *pointer;
+            /// 参照から外された時のエポックです。
+            U64 epoch;
+        };
+
+        /// ConcurrentHashMapの読み取り側が固定したエポックです。
+        class ConcurrentHashMapReader
+        {
+        public:
+            /// 固定したエポックです。固定していない場合、0です。
+            alignas(CACHE_LINE_SIZE) std::atomic<U64> epoch;
+
+            /// 初期化します。
+            ConcurrentHashMapReader() noexcept
+                : epoch(0)
+            {}
+        };
+    }
+    /// @endcond
+
+    /// 読み取りをロックせずに行えるスレッド安全なハッシュマップです。
+    /// キーのハッシュ値でシャードに分割し、書き込みはシャード単位でロックします。
+    /// 要素はノードとして確保され、削除されるまで移動しません。
+    /// 削除、置き換えられたノードと拡張前のテーブルはエポックで解放を遅延し、
+    /// それを読み得るすべての読み取りが終わった後に解放します。
+    /// @tparam K キーの型です。
+    /// @tparam V 値の型です。
+    /// @tparam H ハッシュ関数の型です。
+    /// @tparam E 同等比較関数の型です。
+    /// @tparam SHARD_COUNT シャード数です。(2の累乗)
+    /// @warning 値は挿入後に変更できません。更新はSetで置き換えてください。
+    template<typename K,
+             typename V,
+             typename H           = Hash<K>,
+             typename E           = EqualTo<K>,
+             USize    SHARD_COUNT = 16>
+    class ConcurrentHashMap
+    {
+        static_assert((SHARD_COUNT & (SHARD_COUNT - 1)) == 0,
+                      "SHARD_COUNT must be a power of two.");
+
+        using NodeType  = _Internal::ConcurrentHashMapNode<K, V>;
+        using TableType = _Internal::ConcurrentHashMapTable<NodeType>;
+
+        static constexpr USize TABLE_SIZE_MIN    = 16; // テーブルの最小スロット数です。
+        static constexpr USize READER_COUNT      = 64; // 同時にエポックを固定できる数です。(2の累乗)
+        static constexpr USize RETIRED_COUNT_MIN = 64; // 解放を試みる遅延数の下限です。
+
+        using RetiredNodeType  = _Internal::ConcurrentHashMapRetired<NodeType>;
+        using RetiredTableType = _Internal::ConcurrentHashMapRetired<TableType>;
+
+        /// シャードです。
+        class Shard
+        {
+        public:
+            /// 現在のテーブルです。読み取り側はこれを読みます。
+            alignas(CACHE_LINE_SIZE) std::atomic<TableType *> pTable;
+            /// 書き込みの占有ロックです。
+            std::mutex mutex;
+            /// 要素数です。
+            std::atomic<USize> count;
+            /// 解放を遅延しているテーブルです。
+            Array<RetiredTableType> retiredTables;
+            /// 解放を遅延しているノードです。
+            Array<RetiredNodeType> retiredNodes;
+            /// 次に解放を試みる遅延数です。
+            USize retiredLimit;
+
+            /// 初期化します。
+            Shard() noexcept
+                : pTable(nullptr)
+                , mutex()
+                , count(0)
+                , retiredTables()
+                , retiredNodes()
+                , retiredLimit(RETIRED_COUNT_MIN)
+            {}
+        };
+
+        Shard                              m_shards[SHARD_COUNT];
+        H                                  m_hasher;
+        E                                  m_equal;
+        Allocator<NodeType>                m_nodeAllocator;
+        Allocator<TableType>               m_tableAllocator;
+        Allocator<std::atomic<NodeType *>> m_slotAllocator;
+        alignas(CACHE_LINE_SIZE) mutable std::atomic<U64> m_epoch; // 解放を遅延する世代です。
+        mutable _Internal::ConcurrentHashMapReader m_readers[READER_COUNT]; // 読み取り側の固定枠です。
+
+        /// ハッシュ値を計算します。
+        /// @param key キーです。
+        /// @return 攪拌したハッシュ値です。
+        template<typename Q>
+        U64 _HashOf(const Q &key) const noexcept
+        {
+            return MixHash((U64) this->m_hasher(key));
+        }
+
+        /// ハッシュ値からシャードを取得します。
+        /// @param hash 攪拌したハッシュ値です。
+        /// @return シャードです。
+        Shard &_ShardOf(U64 hash) noexcept
+        {
+            return this->m_shards[(hash >> 32) & (SHARD_COUNT - 1)];
+        }
+
+        /// ハッシュ値からシャードを取得します。
+        /// @param hash 攪拌したハッシュ値です。
+        /// @return シャードです。
+        const Shard &_ShardOf(U64 hash) const noexcept
+        {
+            return this->m_shards[(hash >> 32) & (SHARD_COUNT - 1)];
+        }
+
+        /// メモリ確保の失敗を出力し、異常終了します。
+        [[noreturn]] static void _ExitBadAllocated() noexcept
+        {
+            LogError(TXT("メモリの確保に失敗しました。"
+                         "'ConcurrentHashMap<{}, {}>'"),
+                     TypenameOf<K>(),
+                     TypenameOf<V>());
+
+            ExitError();
+        }
+
+        /// テーブルを作成します。
+        /// @param capacity スロット数です。(2の累乗)
+        /// @return テーブルです。
+        TableType *_CreateTable(USize capacity) noexcept
+        {
+            TableType *pTable = nullptr;
+            if (!this->m_tableAllocator.Allocate(1).IsSuccess(pTable))
+                _ExitBadAllocated();
+            pTable->capacity  = capacity;
+            pTable->usedCount = 0;
+            pTable->pSlots    = nullptr;
+            if (!this->m_slotAllocator.Allocate(capacity).IsSuccess(
+                    pTable->pSlots))
+                _ExitBadAllocated();
+            for (USize i = 0; i < capacity; i++)
+                new (&pTable->pSlots[i]) std::atomic<NodeType *>(nullptr);
+            return pTable;
+        }
+
+        /// テーブルを解放します。ノードは解放しません。
+        /// @param pTable テーブルです。
+        void _DestroyTable(TableType *pTable) noexcept
+        {
+            static_cast<void>(this->m_slotAllocator.Deallocate(
+                pTable->pSlots, pTable->capacity));
+            static_cast<void>(this->m_tableAllocator.Deallocate(pTable, 1));
+        }
+
+        /// ノードを解放します。
+        /// @param pNode ノードです。
+        void _DestroyNode(NodeType *pNode) noexcept
+        {
+            pNode->~NodeType();
+            static_cast<void>(this->m_nodeAllocator.Deallocate(pNode, 1));
+        }
+
+        /// 現在のエポックを読み取り側の枠に固定します。
+        /// 空いている枠が無い場合、空くまで待機します。
+        /// @return 固定した枠です。
+        std::atomic<U64> *_Pin() const noexcept
+        {
+            auto index =
+                (USize) std::hash<std::thread::id>()(std::this_thread::get_id());
+            for (USize i = 1;; i++, index++)
+            {
+                auto &epoch    = this->m_readers[index & (READER_COUNT - 1)].epoch;
+                U64   expected = 0;
+                auto  current  = this->m_epoch.load();
+                if (epoch.load(std::memory_order_relaxed) == 0
+                    && epoch.compare_exchange_strong(expected, current))
+                {
+                    // 固定する間にエポックが進んだ場合、固定し直します。
+                    for (auto latest = this->m_epoch.load(); latest != current;
+                         latest      = this->m_epoch.load())
+                    {
+                        current = latest;
+                        epoch.store(current);
+                    }
+                    return &epoch;
+                }
+                if (i % READER_COUNT == 0)
+                    std::this_thread::yield();
+            }
+        }
+
+        /// 固定されている最も古いエポックを取得します。
+        /// @return エポック、または、固定が無い場合は最大値です。
+        U64 _OldestPinnedEpoch() const noexcept
+        {
+            auto oldest = ~(U64) 0;
+            for (auto &reader : this->m_readers)
+            {
+                auto epoch = reader.epoch.load();
+                if (epoch != 0 && epoch < oldest)
+                    oldest = epoch;
+            }
+            return oldest;
+        }
+
+        /// どの読み取りからも参照されなくなった遅延中のノードとテーブルを解放します。
+        /// シャードのロック中に呼び出します。
+        /// @param shard シャードです。
+        void _ReclaimRetired(Shard &shard) noexcept
+        {
+            auto oldest = this->_OldestPinnedEpoch();
+            for (USize i = 0; i < shard.retiredNodes.Count();)
+            {
+                if (shard.retiredNodes[i].epoch < oldest)
+                {
+                    this->_DestroyNode(shard.retiredNodes[i].pointer);
+                    shard.retiredNodes.RemoveAtSwapLast(i);
+                }
+                else
+                    i++;
+            }
+            for (USize i = 0; i < shard.retiredTables.Count();)
+            {
+                if (shard.retiredTables[i].epoch < oldest)
+                {
+                    this->_DestroyTable(shard.retiredTables[i].pointer);
+                    shard.retiredTables.RemoveAtSwapLast(i);
+                }
+                else
+                    i++;
+            }
+
+            // 読み取りが長く固定している間、毎回走査しないように上限を広げます。
+            auto count = shard.retiredNodes.Count() + shard.retiredTables.Count();
+            shard.retiredLimit =
+                count * 2 > RETIRED_COUNT_MIN ? count * 2 : RETIRED_COUNT_MIN;
+        }
+
+        /// 参照から外したノードとテーブルの解放を遅延します。
+        /// 遅延数が上限に達した場合、解放を試みます。
+        /// シャードのロック中に、参照から外した後で呼び出します。
+        /// @param shard シャードです。
+        /// @param pNode ノード、または、ヌルです。
+        /// @param pTable テーブル、または、ヌルです。
+        void _Retire(Shard &shard, NodeType *pNode, TableType *pTable) noexcept
+        {
+            // エポックを進め、以降に固定した読み取りが参照しないことを保証します。
+            auto epoch = this->m_epoch.fetch_add(1);
+            if (pNode != nullptr)
+                shard.retiredNodes.Add(RetiredNodeType{pNode, epoch});
+            if (pTable != nullptr)
+                shard.retiredTables.Add(RetiredTableType{pTable, epoch});
+            if (shard.retiredNodes.Count() + shard.retiredTables.Count()
+                >= shard.retiredLimit)
+                this->_ReclaimRetired(shard);
+        }
+
+        /// テーブルからキーを探索します。
+        /// @param pTable テーブルです。
+        /// @param hash 攪拌したハッシュ値です。
+        /// @param key キーです。
+        /// @return スロット、または、ヌルです。
+        template<typename Q>
+        std::atomic<NodeType *> *
+        _FindSlot(TableType *pTable, U64 hash, const Q &key) const noexcept
+        {
+            auto mask = pTable->capacity - 1;
+            for (auto i = (USize) hash & mask;; i = (i + 1) & mask)
+            {
+                auto pNode = pTable->pSlots[i].load(std::memory_order_acquire);
+                if (pNode == nullptr)
+                    return nullptr;
+                if (pNode != TableType::Tombstone() && pNode->hash == hash
+                    && this->m_equal(pNode->key, key))
+                    return &pTable->pSlots[i];
+            }
+        }
+
+        /// ノードをテーブルの空きスロットに配置します。
+        /// シャードのロック中に呼び出します。
+        /// @param pTable テーブルです。
+        /// @param pNode ノードです。
+        static void _PlaceNode(TableType *pTable, NodeType *pNode) noexcept
+        {
+            auto mask = pTable->capacity - 1;
+            for (auto i = (USize) pNode->hash & mask;; i = (i + 1) & mask)
+            {
+                if (pTable->pSlots[i].load(std::memory_order_relaxed)
+                    == nullptr)
+                {
+                    pTable->pSlots[i].store(pNode, std::memory_order_release);
+                    pTable->usedCount += 1;
+                    return;
+                }
+            }
+        }
+
+        /// 1要素追加できるようにテーブルを用意します。
+        /// シャードのロック中に呼び出します。
+        /// @param shard シャードです。
+        /// @return 追加先のテーブルです。
+        TableType *_PrepareInsert(Shard &shard) noexcept
+        {
+            auto pTable = shard.pTable.load(std::memory_order_relaxed);
+            if (pTable != nullptr
+                && (pTable->usedCount + 1) * 4 <= pTable->capacity * 3)
+                return pTable;
+
+            // 拡張、または、削除済みスロットを掃除したテーブルに移します。
+            auto count    = shard.count.load(std::memory_order_relaxed);
+            auto capacity = (USize) NextPowerOfTwo((count + 1) * 2);
+            if (capacity < TABLE_SIZE_MIN)
+                capacity = TABLE_SIZE_MIN;
+            auto pNewTable = this->_CreateTable(capacity);
+            if (pTable != nullptr)
+            {
+                for (USize i = 0; i < pTable->capacity; i++)
+                {
+                    auto pNode =
+                        pTable->pSlots[i].load(std::memory_order_relaxed);
+                    if (pNode != nullptr && pNode != TableType::Tombstone())
+                        _PlaceNode(pNewTable, pNode);
+                }
+            }
+            shard.pTable.store(pNewTable, std::memory_order_release);
+            if (pTable != nullptr)
+                this->_Retire(shard, nullptr, pTable);
+            return pNewTable;
+        }
+
+        /// ノードを作成します。
+        /// @param hash 攪拌したハッシュ値です。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @return ノードです。
+        template<typename KK, typename VV>
+        NodeType *_CreateNode(U64 hash, KK &&key, VV &&value) noexcept
+        {
+            NodeType *pNode = nullptr;
+            if (!this->m_nodeAllocator.Allocate(1).IsSuccess(pNode))
+                _ExitBadAllocated();
+            return new (pNode)
+                NodeType(hash, Forward<KK>(key), Forward<VV>(value));
+        }
+
+        /// 値を検索し、無ければ追加します。
+        /// @param key キーです。
+        /// @param value 追加する値です。
+        /// @param isInserted 追加した場合、真を受け取ります。
+        /// @return 既存、または、追加した値のポインタです。
+        template<typename KK, typename VV>
+        const V *_FindOrAdd(KK &&key, VV &&value, Bool &isInserted) noexcept
+        {
+            isInserted = false;
+            if (auto pValue = this->Find(key))
+                return pValue;
+
+            auto  hash  = this->_HashOf(key);
+            auto &shard = this->_ShardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto pTable = shard.pTable.load(std::memory_order_relaxed);
+            if (pTable != nullptr)
+            {
+                if (auto pSlot = this->_FindSlot(pTable, hash, key))
+                    return &pSlot->load(std::memory_order_relaxed)->value;
+            }
+            pTable     = this->_PrepareInsert(shard);
+            auto pNode = this->_CreateNode(hash,
+                                           Forward<KK>(key),
+                                           Forward<VV>(value));
+            _PlaceNode(pTable, pNode);
+            shard.count.fetch_add(1, std::memory_order_relaxed);
+            isInserted = true;
+            return &pNode->value;
+        }
+
+    public:
+        /// キーの型です。
+        using KeyType = K;
+        /// 値の型です。
+        using ValueType = V;
+
+        /// 読み取り中のエポックを固定するガードです。
+        /// 生存中は、取得した値のポインタが解放されません。
+        class Guard
+        {
+            std::atomic<U64> *m_pEpoch; // 固定した枠です。
+
+        public:
+            /// エポックを固定します。
+            /// @param map 読み取るマップです。
+            explicit Guard(const ConcurrentHashMap &map) noexcept
+                : m_pEpoch(map._Pin())
+            {}
+
+            Guard(const Guard &)            = delete;
+            Guard &operator=(const Guard &) = delete;
+
+            /// ムーブします。
+            /// @param origin ムーブ元です。
+            Guard(Guard &&origin) noexcept
+                : m_pEpoch(origin.m_pEpoch)
+            {
+                origin.m_pEpoch = nullptr;
+            }
+
+            /// 固定を解除します。
+            ~Guard() noexcept
+            {
+                if (this->m_pEpoch != nullptr)
+                    this->m_pEpoch->store(0, std::memory_order_release);
+            }
+        };
+
+        /// 初期化します。
+        ConcurrentHashMap() noexcept
+            : m_hasher()
+            , m_equal()
+            , m_nodeAllocator()
+            , m_tableAllocator()
+            , m_slotAllocator()
+            , m_epoch(1)
+            , m_readers()
+        {}
+
+        ConcurrentHashMap(const ConcurrentHashMap &)            = delete;
+        ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+        /// 解体します。
+        /// @warning 他のスレッドが使用していない状態で解体してください。
+        ~ConcurrentHashMap() noexcept
+        {
+            for (auto &shard : this->m_shards)
+            {
+                for (USize i = 0; i < shard.retiredNodes.Count(); i++)
+                    this->_DestroyNode(shard.retiredNodes[i].pointer);
+                for (USize i = 0; i < shard.retiredTables.Count(); i++)
+                    this->_DestroyTable(shard.retiredTables[i].pointer);
+
+                auto pTable = shard.pTable.load(std::memory_order_relaxed);
+                if (pTable == nullptr)
+                    continue;
+                for (USize i = 0; i < pTable->capacity; i++)
+                {
+                    auto pNode =
+                        pTable->pSlots[i].load(std::memory_order_relaxed);
+                    if (pNode != nullptr && pNode != TableType::Tombstone())
+                        this->_DestroyNode(pNode);
+                }
+                this->_DestroyTable(pTable);
+            }
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。他スレッドの操作中は概算値です。
+        USize Count() const noexcept
+        {
+            USize count = 0;
+            for (auto &shard : this->m_shards)
+                count += shard.count.load(std::memory_order_relaxed);
+            return count;
+        }
+
+        /// 読み取り中のエポックを固定します。
+        /// @return 固定を解除するまで、取得した値のポインタを保護するガードです。
+        Guard Pin() const noexcept
+        {
+            return Guard(*this);
+        }
+
+        /// 値を検索します。ロックせず、探索中はエポックを固定します。
+        /// ハッシュ関数、同等比較関数がIsTransparentを持つ場合、キー以外の型でも検索できます。
+        /// @param key 検索するキーです。
+        /// @return 値のポインタ、または、ヌルです。
+        /// @warning 他スレッドが削除、置き換える要素の値を読む場合、Pinで得たガードの生存中に検索、使用してください。
+        template<typename Q>
+        const V *Find(const Q &key) const noexcept
+        {
+            Guard guard(*this);
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            auto  hash   = this->_HashOf(lookup);
+            auto &shard  = this->_ShardOf(hash);
+            auto  pTable = shard.pTable.load(std::memory_order_acquire);
+            if (pTable == nullptr)
+                return nullptr;
+            auto pSlot = this->_FindSlot(pTable, hash, lookup);
+            if (pSlot == nullptr)
+                return nullptr;
+            auto pNode = pSlot->load(std::memory_order_acquire);
+            return pNode != TableType::Tombstone() ? &pNode->value : nullptr;
+        }
+
+        /// キーが存在するか判定します。ロックしません。
+        /// @param key 検索するキーです。
+        /// @return 存在する場合、真です。
+        template<typename Q>
+        Bool Contains(const Q &key) const noexcept
+        {
+            return this->Find(key) != nullptr;
+        }
+
+        /// 値を検索し、無ければ追加します。
+        /// 既に存在する場合、ロックせずに返します。
+        /// @param key キーです。
+        /// @param value 追加する値です。
+        /// @return 既存、または、追加した値のポインタです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        const V *FindOrAdd(KK &&key, VV &&value) noexcept
+        {
+            Bool isInserted = false;
+            return this->_FindOrAdd(Forward<KK>(key),
+                                    Forward<VV>(value),
+                                    isInserted);
+        }
+
+        /// 要素を追加します。キーが既に存在する場合、何もしません。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @return 追加した場合、真です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        Bool Add(KK &&key, VV &&value) noexcept
+        {
+            Bool isInserted = false;
+            this->_FindOrAdd(Forward<KK>(key), Forward<VV>(value), isInserted);
+            return isInserted;
+        }
+
+        /// 要素を設定します。キーが既に存在する場合、新しいノードに置き換えます。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        void Set(KK &&key, VV &&value) noexcept
+        {
+            auto  hash  = this->_HashOf(key);
+            auto &shard = this->_ShardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto pNode = this->_CreateNode(hash,
+                                           Forward<KK>(key),
+                                           Forward<VV>(value));
+            auto pTable = shard.pTable.load(std::memory_order_relaxed);
+            if (pTable != nullptr)
+            {
+                if (auto pSlot = this->_FindSlot(pTable, hash, pNode->key))
+                {
+                    auto pOldNode = pSlot->load(std::memory_order_relaxed);
+                    pSlot->store(pNode, std::memory_order_release);
+                    this->_Retire(shard, pOldNode, nullptr);
+                    return;
+                }
+            }
+            pTable = this->_PrepareInsert(shard);
+            _PlaceNode(pTable, pNode);
+            shard.count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// 要素を削除します。
+        /// ノードは読み取り中のスレッドが無くなった後に解放されます。
+        /// @param key 削除するキーです。
+        /// @return 削除した場合、真です。
+        template<typename Q>
+        Bool Remove(const Q &key) noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            auto  hash  = this->_HashOf(lookup);
+            auto &shard = this->_ShardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto pTable = shard.pTable.load(std::memory_order_relaxed);
+            if (pTable == nullptr)
+                return false;
+            auto pSlot = this->_FindSlot(pTable, hash, lookup);
+            if (pSlot == nullptr)
+                return false;
+            auto pNode = pSlot->load(std::memory_order_relaxed);
+            pSlot->store(TableType::Tombstone(), std::memory_order_release);
+            shard.count.fetch_sub(1, std::memory_order_relaxed);
+            this->_Retire(shard, pNode, nullptr);
+            return true;
+        }
+
+        /// 削除、置き換えられたノードと拡張前のテーブルのうち、
+        /// どの読み取りからも参照されなくなったものを解放します。
+        /// 解放は書き込み時にも行われるため、呼び出しは任意です。
+        void Reclaim() noexcept
+        {
+            for (auto &shard : this->m_shards)
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                this->_ReclaimRetired(shard);
+            }
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_CONCURRENTHASHMAP_HPP
\ No newline at end of file
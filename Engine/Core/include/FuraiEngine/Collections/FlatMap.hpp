@@ -0,0 +1,253 @@
+/// @file FuraiEngine/Collections/FlatMap.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 整列済み配列によるマップを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_FLATMAP_HPP
+#define _FURAIENGINE_COLLECTIONS_FLATMAP_HPP
+#include "FuraiEngine/Collections/FlatTable.hpp"
+#include "FuraiEngine/Collections/KeyValuePair.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// キーと値の組からキーを取り出します。
+        class FlatMapKeyOf
+        {
+        public:
+            /// キーを取り出します。
+            /// @param pair キーと値の組です。
+            /// @return キーです。
+            template<typename K, typename V>
+            static const K &KeyOf(const KeyValuePair<K, V> &pair) noexcept
+            {
+                return pair.key;
+            }
+        };
+    }
+    /// @endcond
+
+    /// キーで整列した連続配列によるマップです。
+    /// 一度構築して何度も検索する用途に適しています。
+    /// 追加、削除は要素をずらすためO(n)です。
+    /// @tparam K キーの型です。
+    /// @tparam V 値の型です。
+    /// @tparam A アロケータの型です。要素型はKeyValuePair<K, V>です。
+    /// @tparam C キーの小なり比較関数の型です。
+    /// @warning 要素の追加、削除でイテレータ、ポインタは無効になります。
+    template<typename K,
+             typename V,
+             typename A = Allocator<KeyValuePair<K, V>>,
+             typename C = Less<K>>
+    class FlatMap
+    {
+        using TableType = _Internal::
+            FlatTable<KeyValuePair<K, V>, K, A, C, _Internal::FlatMapKeyOf>;
+
+    public:
+        /// キーの型です。
+        using KeyType = K;
+        /// 値の型です。
+        using ValueType = V;
+        /// 要素の型です。
+        using ElementType = KeyValuePair<K, V>;
+        /// 要素配列の型です。
+        using ArrayType = Array<ElementType, A>;
+        /// アロケータの型です。
+        using AllocatorType = A;
+        /// 可変イテレータの型です。
+        /// @warning 要素のキーを変更しないでください。
+        using IteratorType = typename ArrayType::IteratorType;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename ArrayType::ConstIteratorType;
+
+    private:
+        TableType m_table;
+
+    public:
+        /// 初期化します。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        FlatMap(const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {}
+
+        /// 未整列の要素配列から一括で構築します。
+        /// 要素を全て追加してから1度だけ整列するため、1つずつ追加するより高速です。
+        /// キーが重複する場合、後ろの要素が残ります。
+        /// @param elements 要素配列です。
+        FlatMap(ArrayType &&elements) noexcept
+            : m_table(Move(elements))
+        {}
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        FlatMap(FlatMap<K, V, A, C> &&origin) noexcept = default;
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        FlatMap<K, V, A, C> &
+        operator=(FlatMap<K, V, A, C> &&origin) noexcept = default;
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_table.Elements().Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_table.Elements().IsEmpty();
+        }
+
+        /// 要素を追加します。キーが既に存在する場合、何もしません。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @return 追加した場合、真です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        Bool Add(KK &&key, VV &&value) noexcept
+        {
+            Bool isInserted = false;
+            this->m_table.FindOrInsert(
+                key,
+                [&]()
+                {
+                    return ElementType(Forward<KK>(key), Forward<VV>(value));
+                },
+                isInserted);
+            return isInserted;
+        }
+
+        /// 要素を設定します。キーが既に存在する場合、値を上書きします。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        void Set(KK &&key, VV &&value) noexcept
+        {
+            auto index = this->m_table.IndexOf(key);
+            if (index != USIZE_MAX)
+                this->m_table.Elements()[index].value = Forward<VV>(value);
+            else
+                this->Add(Forward<KK>(key), Forward<VV>(value));
+        }
+
+        /// 値にアクセスします。キーが存在しない場合、既定値で追加します。
+        /// @param key キーです。
+        /// @return 値の参照です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK>
+        V &operator[](KK &&key) noexcept
+        {
+            Bool isInserted = false;
+            auto index      = this->m_table.FindOrInsert(
+                key,
+                [&]()
+                {
+                    return ElementType(Forward<KK>(key));
+                },
+                isInserted);
+            return this->m_table.Elements()[index].value;
+        }
+
+        /// 値を検索します。
+        /// 比較関数がIsTransparentを持つ場合、キー以外の型でも検索できます。
+        /// @param key 検索するキーです。
+        /// @return 値のポインタ、または、ヌルです。
+        template<typename Q>
+        V *Find(const Q &key) noexcept
+        {
+            const _Internal::TransparentKeyType<K, Q, C> &lookup = key;
+            auto index = this->m_table.IndexOf(lookup);
+            return index != USIZE_MAX ? &this->m_table.Elements()[index].value
+                                      : nullptr;
+        }
+
+        /// 値を検索します。
+        /// 比較関数がIsTransparentを持つ場合、キー以外の型でも検索できます。
+        /// @param key 検索するキーです。
+        /// @return 値のポインタ、または、ヌルです。
+        template<typename Q>
+        const V *Find(const Q &key) const noexcept
+        {
+            const _Internal::TransparentKeyType<K, Q, C> &lookup = key;
+            auto index = this->m_table.IndexOf(lookup);
+            return index != USIZE_MAX ? &this->m_table.Elements()[index].value
+                                      : nullptr;
+        }
+
+        /// キーが存在するか判定します。
+        /// @param key 検索するキーです。
+        /// @return 存在する場合、真です。
+        template<typename Q>
+        Bool Contains(const Q &key) const noexcept
+        {
+            const _Internal::TransparentKeyType<K, Q, C> &lookup = key;
+            return this->m_table.IndexOf(lookup) != USIZE_MAX;
+        }
+
+        /// 要素を削除します。
+        /// @param key 削除するキーです。
+        /// @return 削除した場合、真です。
+        template<typename Q>
+        Bool Remove(const Q &key) noexcept
+        {
+            const _Internal::TransparentKeyType<K, Q, C> &lookup = key;
+            auto index = this->m_table.IndexOf(lookup);
+            if (index == USIZE_MAX)
+                return false;
+            this->m_table.Elements().RemoveAt(index);
+            return true;
+        }
+
+        /// 指定要素数を拡張せずに保持できるよう容量を確保します。
+        /// @param count 要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_table.Elements().Reserve(count);
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            this->m_table.Elements().Clear();
+        }
+
+        /// 先頭のイテレータを取得します。
+        /// @return 先頭のイテレータです。
+        IteratorType begin() noexcept
+        {
+            return this->m_table.Elements().begin();
+        }
+
+        /// 終端のイテレータを取得します。
+        /// @return 終端のイテレータです。
+        IteratorType end() noexcept
+        {
+            return this->m_table.Elements().end();
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_table.Elements().begin();
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_table.Elements().end();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_FLATMAP_HPP
\ No newline at end of file
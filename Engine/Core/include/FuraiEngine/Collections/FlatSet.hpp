@@ -0,0 +1,185 @@
+/// @file FuraiEngine/Collections/FlatSet.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 整列済み配列によるセットを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_FLATSET_HPP
+#define _FURAIENGINE_COLLECTIONS_FLATSET_HPP
+#include "FuraiEngine/Collections/FlatTable.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 要素自身をキーとして取り出します。
+        class FlatSetKeyOf
+        {
+        public:
+            /// キーを取り出します。
+            /// @param value 要素です。
+            /// @return キーです。
+            template<typename K>
+            static const K &KeyOf(const K &value) noexcept
+            {
+                return value;
+            }
+        };
+    }
+    /// @endcond
+
+    /// 整列した連続配列によるセットです。
+    /// 一度構築して何度も検索する用途に適しています。
+    /// 追加、削除は要素をずらすためO(n)です。
+    /// @tparam K 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @tparam C 小なり比較関数の型です。
+    /// @warning 要素の追加、削除でイテレータ、ポインタは無効になります。
+    template<typename K, typename A = Allocator<K>, typename C = Less<K>>
+    class FlatSet
+    {
+        using TableType =
+            _Internal::FlatTable<K, K, A, C, _Internal::FlatSetKeyOf>;
+
+    public:
+        /// 要素の型です。
+        using ElementType = K;
+        /// 要素配列の型です。
+        using ArrayType = Array<K, A>;
+        /// アロケータの型です。
+        using AllocatorType = A;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename ArrayType::ConstIteratorType;
+
+    private:
+        TableType m_table;
+
+    public:
+        /// 初期化します。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        FlatSet(const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {}
+
+        /// 未整列の要素配列から一括で構築します。
+        /// 要素を全て追加してから1度だけ整列するため、1つずつ追加するより高速です。
+        /// @param elements 要素配列です。
+        FlatSet(ArrayType &&elements) noexcept
+            : m_table(Move(elements))
+        {}
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        FlatSet(FlatSet<K, A, C> &&origin) noexcept = default;
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        FlatSet<K, A, C> &
+        operator=(FlatSet<K, A, C> &&origin) noexcept = default;
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_table.Elements().Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_table.Elements().IsEmpty();
+        }
+
+        /// 要素にアクセスします。要素は整列済みです。
+        /// @param index 要素の位置です。
+        /// @return 要素の参照です。
+        const K &operator[](USize index) const noexcept
+        {
+            return this->m_table.Elements()[index];
+        }
+
+        /// 要素を追加します。
+        /// @param value 要素です。
+        /// @return 追加した場合、真です。既に存在した場合、偽です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK>
+        Bool Add(KK &&value) noexcept
+        {
+            Bool isInserted = false;
+            this->m_table.FindOrInsert(
+                value,
+                [&]()
+                {
+                    return K(Forward<KK>(value));
+                },
+                isInserted);
+            return isInserted;
+        }
+
+        /// 要素の位置を検索します。
+        /// 比較関数がIsTransparentを持つ場合、要素以外の型でも検索できます。
+        /// @param value 検索する値です。
+        /// @return 要素の位置です。見つからない場合、USIZE_MAXです。
+        template<typename Q>
+        USize IndexOf(const Q &value) const noexcept
+        {
+            const _Internal::TransparentKeyType<K, Q, C> &lookup = value;
+            return this->m_table.IndexOf(lookup);
+        }
+
+        /// 要素が存在するか判定します。
+        /// 比較関数がIsTransparentを持つ場合、要素以外の型でも検索できます。
+        /// @param value 検索する値です。
+        /// @return 存在する場合、真です。
+        template<typename Q>
+        Bool Contains(const Q &value) const noexcept
+        {
+            return this->IndexOf(value) != USIZE_MAX;
+        }
+
+        /// 要素を削除します。
+        /// @param value 削除する値です。
+        /// @return 削除した場合、真です。
+        template<typename Q>
+        Bool Remove(const Q &value) noexcept
+        {
+            auto index = this->IndexOf(value);
+            if (index == USIZE_MAX)
+                return false;
+            this->m_table.Elements().RemoveAt(index);
+            return true;
+        }
+
+        /// 指定要素数を拡張せずに保持できるよう容量を確保します。
+        /// @param count 要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_table.Elements().Reserve(count);
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            this->m_table.Elements().Clear();
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_table.Elements().begin();
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_table.Elements().end();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_FLATSET_HPP
\ No newline at end of file
@@ -0,0 +1,173 @@
+/// @file FuraiEngine/Collections/FlatTable.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 整列済み配列による連想テーブルを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_FLATTABLE_HPP
+#define _FURAIENGINE_COLLECTIONS_FLATTABLE_HPP
+#include <algorithm>
+#include "FuraiEngine/Collections/Array.hpp"
+#include "FuraiEngine/Compare.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// キーで整列した配列による連想テーブルです。
+        /// 検索は分岐の無い二分探索で行います。
+        /// @tparam S 要素の型です。
+        /// @tparam K キーの型です。
+        /// @tparam A アロケータの型です。要素型はSです。
+        /// @tparam C キーの小なり比較関数の型です。
+        /// @tparam X 要素からキーを取り出す型です。
+        template<typename S,
+                 typename K,
+                 typename A,
+                 typename C,
+                 typename X>
+        class FlatTable
+        {
+        public:
+            /// 要素の型です。
+            using ElementType = S;
+            /// キーの型です。
+            using KeyType = K;
+            /// 要素配列の型です。
+            using ArrayType = Array<S, A>;
+            /// アロケータの型です。
+            using AllocatorType = A;
+            /// キーの小なり比較関数の型です。
+            using CompareType = C;
+
+        private:
+            ArrayType   m_elements; // キーで整列した要素です。
+            CompareType m_compare;
+
+        public:
+            /// 初期化します。
+            /// @param allocator アロケータです。
+            /// @warning メモリ確保に失敗した場合、異常終了します。
+            FlatTable(const AllocatorType &allocator) noexcept
+                : m_elements(allocator)
+                , m_compare()
+            {}
+
+            /// 未整列の要素配列から一括で構築します。
+            /// キーが重複する場合、後ろの要素が残ります。
+            /// @param elements 要素配列です。
+            FlatTable(ArrayType &&elements) noexcept
+                : m_elements(Move(elements))
+                , m_compare()
+            {
+                auto pBegin  = this->m_elements.Data();
+                auto pEnd    = pBegin + this->m_elements.Count();
+                auto compare = this->m_compare;
+                std::stable_sort(pBegin,
+                                 pEnd,
+                                 [&compare](const S &l, const S &r)
+                                 {
+                                     return compare(X::KeyOf(l),
+                                                    X::KeyOf(r));
+                                 });
+
+                // 重複したキーを取り除きます。
+                USize count = 0;
+                for (USize i = 0; i < this->m_elements.Count(); i++)
+                {
+                    auto isLast = i + 1 == this->m_elements.Count()
+                               || compare(X::KeyOf(pBegin[i]),
+                                          X::KeyOf(pBegin[i + 1]));
+                    if (!isLast)
+                        continue;
+                    if (count != i)
+                        pBegin[count] = Move(pBegin[i]);
+                    count += 1;
+                }
+                while (this->m_elements.Count() > count)
+                    this->m_elements.RemoveLast();
+            }
+
+            /// 要素配列を取得します。
+            /// @return 要素配列です。
+            const ArrayType &Elements() const noexcept
+            {
+                return this->m_elements;
+            }
+
+            /// 要素配列を取得します。
+            /// @return 要素配列です。
+            /// @warning 要素のキーを変更しないでください。
+            ArrayType &Elements() noexcept
+            {
+                return this->m_elements;
+            }
+
+            /// 指定キー以上の最初の要素の位置を取得します。
+            /// @tparam Q キーと比較可能な型です。
+            /// @param key 検索するキーです。
+            /// @return 要素の位置です。見つからない場合、要素数です。
+            template<typename Q>
+            USize LowerBound(const Q &key) const noexcept
+            {
+                auto count = this->m_elements.Count();
+                if (count == 0)
+                    return 0;
+
+                auto pArray = this->m_elements.Data();
+                auto pBase  = pArray;
+                while (count > 1)
+                {
+                    auto half = count / 2;
+                    pBase = this->m_compare(X::KeyOf(pBase[half]), key)
+                              ? pBase + half
+                              : pBase;
+                    count -= half;
+                }
+                return (USize) (pBase - pArray)
+                     + (this->m_compare(X::KeyOf(*pBase), key) ? 1 : 0);
+            }
+
+            /// キーを検索します。
+            /// @tparam Q キーと比較可能な型です。
+            /// @param key 検索するキーです。
+            /// @return 要素の位置です。見つからない場合、USIZE_MAXです。
+            template<typename Q>
+            USize IndexOf(const Q &key) const noexcept
+            {
+                auto index = this->LowerBound(key);
+                if (index < this->m_elements.Count()
+                    && !this->m_compare(key,
+                                        X::KeyOf(this->m_elements[index])))
+                    return index;
+                return USIZE_MAX;
+            }
+
+            /// キーを検索し、無ければ挿入します。
+            /// @param key 検索するキーです。
+            /// @param element 挿入する要素を生成する関数です。
+            /// @param isInserted 挿入した場合、真を受け取ります。
+            /// @return 要素の位置です。
+            /// @warning メモリ確保に失敗した場合、異常終了します。
+            template<typename Q, typename F>
+            USize FindOrInsert(const Q &key,
+                               F      &&element,
+                               Bool    &isInserted) noexcept
+            {
+                auto index = this->LowerBound(key);
+                if (index < this->m_elements.Count()
+                    && !this->m_compare(key,
+                                        X::KeyOf(this->m_elements[index])))
+                {
+                    isInserted = false;
+                    return index;
+                }
+                this->m_elements.Insert(index, element());
+                isInserted = true;
+                return index;
+            }
+        };
+    }
+    /// @endcond
+}
+#endif // !_FURAIENGINE_COLLECTIONS_FLATTABLE_HPP
\ No newline at end of file
@@ -0,0 +1,255 @@
+/// @file FuraiEngine/Collections/HashMap.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// ハッシュマップを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_HASHMAP_HPP
+#define _FURAIENGINE_COLLECTIONS_HASHMAP_HPP
+#include "FuraiEngine/Collections/HashTable.hpp"
+#include "FuraiEngine/Collections/KeyValuePair.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// キーと値の組からキーを取り出します。
+        class KeyValuePairKeyOf
+        {
+        public:
+            /// キーを取り出します。
+            /// @param pair キーと値の組です。
+            /// @return キーです。
+            template<typename K, typename V>
+            static const K &KeyOf(const KeyValuePair<K, V> &pair) noexcept
+            {
+                return pair.key;
+            }
+        };
+    }
+    /// @endcond
+
+    /// オープンアドレス法のハッシュマップです。
+    /// 要素はノードを持たず連続したスロットに直接格納されます。
+    /// @tparam K キーの型です。
+    /// @tparam V 値の型です。
+    /// @tparam A アロケータの型です。要素型はKeyValuePair<K, V>です。
+    /// @tparam H ハッシュ関数の型です。
+    /// @tparam E 同等比較関数の型です。
+    /// @warning 要素の追加、削除でイテレータ、ポインタは無効になります。
+    template<typename K,
+             typename V,
+             typename A = Allocator<KeyValuePair<K, V>>,
+             typename H = Hash<K>,
+             typename E = EqualTo<K>>
+    class HashMap
+    {
+        using TableType = _Internal::HashTable<KeyValuePair<K, V>,
+                                               K,
+                                               A,
+                                               H,
+                                               E,
+                                               _Internal::KeyValuePairKeyOf>;
+
+    public:
+        /// キーの型です。
+        using KeyType = K;
+        /// 値の型です。
+        using ValueType = V;
+        /// 要素の型です。
+        using ElementType = KeyValuePair<K, V>;
+        /// アロケータの型です。
+        using AllocatorType = A;
+        /// 可変イテレータの型です。
+        /// @warning 要素のキーを変更しないでください。
+        using IteratorType = typename TableType::IteratorType;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename TableType::ConstIteratorType;
+
+    private:
+        TableType m_table;
+
+    public:
+        /// 初期化します。
+        /// @param allocator アロケータです。
+        HashMap(const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {}
+
+        /// 容量を指定して初期化します。
+        /// @param count 拡張せずに保持できる要素数です。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        HashMap(USize                count,
+                const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {
+            this->m_table.Reserve(count);
+        }
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        HashMap(HashMap<K, V, A, H, E> &&origin) noexcept
+            : m_table(Move(origin.m_table))
+        {}
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        HashMap<K, V, A, H, E> &
+        operator=(HashMap<K, V, A, H, E> &&origin) noexcept
+        {
+            this->m_table = Move(origin.m_table);
+            return *this;
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_table.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_table.Count() == 0;
+        }
+
+        /// 要素を追加します。キーが既に存在する場合、何もしません。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @return 追加した場合、真です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        Bool Add(KK &&key, VV &&value) noexcept
+        {
+            Bool isInserted = false;
+            auto pSlot = this->m_table.FindOrPrepareInsert(key, isInserted);
+            if (isInserted)
+                new (pSlot) ElementType(Forward<KK>(key), Forward<VV>(value));
+            return isInserted;
+        }
+
+        /// 要素を設定します。キーが既に存在する場合、値を上書きします。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK, typename VV>
+        void Set(KK &&key, VV &&value) noexcept
+        {
+            Bool isInserted = false;
+            auto pSlot = this->m_table.FindOrPrepareInsert(key, isInserted);
+            if (isInserted)
+                new (pSlot) ElementType(Forward<KK>(key), Forward<VV>(value));
+            else
+                pSlot->value = Forward<VV>(value);
+        }
+
+        /// 値にアクセスします。キーが存在しない場合、既定値で追加します。
+        /// @param key キーです。
+        /// @return 値の参照です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK>
+        V &operator[](KK &&key) noexcept
+        {
+            Bool isInserted = false;
+            auto pSlot = this->m_table.FindOrPrepareInsert(key, isInserted);
+            if (isInserted)
+                new (pSlot) ElementType(Forward<KK>(key));
+            return pSlot->value;
+        }
+
+        /// 値を検索します。
+        /// ハッシュ関数、同等比較関数がIsTransparentを持つ場合、キー以外の型でも検索できます。
+        /// @param key 検索するキーです。
+        /// @return 値のポインタ、または、ヌルです。
+        template<typename Q>
+        V *Find(const Q &key) noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            auto pSlot = this->m_table.Find(lookup);
+            return pSlot != nullptr ? &pSlot->value : nullptr;
+        }
+
+        /// 値を検索します。
+        /// ハッシュ関数、同等比較関数がIsTransparentを持つ場合、キー以外の型でも検索できます。
+        /// @param key 検索するキーです。
+        /// @return 値のポインタ、または、ヌルです。
+        template<typename Q>
+        const V *Find(const Q &key) const noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            auto pSlot = this->m_table.Find(lookup);
+            return pSlot != nullptr ? &pSlot->value : nullptr;
+        }
+
+        /// キーが存在するか判定します。
+        /// @param key 検索するキーです。
+        /// @return 存在する場合、真です。
+        template<typename Q>
+        Bool Contains(const Q &key) const noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            return this->m_table.Find(lookup) != nullptr;
+        }
+
+        /// 要素を削除します。
+        /// @param key 削除するキーです。
+        /// @return 削除した場合、真です。
+        template<typename Q>
+        Bool Remove(const Q &key) noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = key;
+            auto pSlot = this->m_table.Find(lookup);
+            if (pSlot == nullptr)
+                return false;
+            this->m_table.EraseSlot(pSlot);
+            return true;
+        }
+
+        /// 指定要素数を拡張せずに保持できるよう容量を確保します。
+        /// @param count 要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_table.Reserve(count);
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            this->m_table.Clear();
+        }
+
+        /// 先頭のイテレータを取得します。
+        /// @return 先頭のイテレータです。
+        IteratorType begin() noexcept
+        {
+            return this->m_table.begin();
+        }
+
+        /// 終端のイテレータを取得します。
+        /// @return 終端のイテレータです。
+        IteratorType end() noexcept
+        {
+            return this->m_table.end();
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_table.begin();
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_table.end();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_HASHMAP_HPP
\ No newline at end of file
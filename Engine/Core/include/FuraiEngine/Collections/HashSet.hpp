@@ -0,0 +1,172 @@
+/// @file FuraiEngine/Collections/HashSet.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// ハッシュセットを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_HASHSET_HPP
+#define _FURAIENGINE_COLLECTIONS_HASHSET_HPP
+#include "FuraiEngine/Collections/HashTable.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 要素自身をキーとして取り出します。
+        class IdentityKeyOf
+        {
+        public:
+            /// キーを取り出します。
+            /// @param value 要素です。
+            /// @return キーです。
+            template<typename K>
+            static const K &KeyOf(const K &value) noexcept
+            {
+                return value;
+            }
+        };
+    }
+    /// @endcond
+
+    /// オープンアドレス法のハッシュセットです。
+    /// @tparam K 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @tparam H ハッシュ関数の型です。
+    /// @tparam E 同等比較関数の型です。
+    /// @warning 要素の追加、削除でイテレータ、ポインタは無効になります。
+    template<typename K,
+             typename A = Allocator<K>,
+             typename H = Hash<K>,
+             typename E = EqualTo<K>>
+    class HashSet
+    {
+        using TableType = _Internal::
+            HashTable<K, K, A, H, E, _Internal::IdentityKeyOf>;
+
+    public:
+        /// 要素の型です。
+        using ElementType = K;
+        /// アロケータの型です。
+        using AllocatorType = A;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename TableType::ConstIteratorType;
+
+    private:
+        TableType m_table;
+
+    public:
+        /// 初期化します。
+        /// @param allocator アロケータです。
+        HashSet(const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {}
+
+        /// 容量を指定して初期化します。
+        /// @param count 拡張せずに保持できる要素数です。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        HashSet(USize                count,
+                const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_table(allocator)
+        {
+            this->m_table.Reserve(count);
+        }
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        HashSet(HashSet<K, A, H, E> &&origin) noexcept
+            : m_table(Move(origin.m_table))
+        {}
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        HashSet<K, A, H, E> &operator=(HashSet<K, A, H, E> &&origin) noexcept
+        {
+            this->m_table = Move(origin.m_table);
+            return *this;
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_table.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_table.Count() == 0;
+        }
+
+        /// 要素を追加します。
+        /// @param value 要素です。
+        /// @return 追加した場合、真です。既に存在した場合、偽です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename KK>
+        Bool Add(KK &&value) noexcept
+        {
+            Bool isInserted = false;
+            auto pSlot = this->m_table.FindOrPrepareInsert(value, isInserted);
+            if (isInserted)
+                new (pSlot) K(Forward<KK>(value));
+            return isInserted;
+        }
+
+        /// 要素が存在するか判定します。
+        /// ハッシュ関数、同等比較関数がIsTransparentを持つ場合、要素以外の型でも検索できます。
+        /// @param value 検索する値です。
+        /// @return 存在する場合、真です。
+        template<typename Q>
+        Bool Contains(const Q &value) const noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = value;
+            return this->m_table.Find(lookup) != nullptr;
+        }
+
+        /// 要素を削除します。
+        /// @param value 削除する値です。
+        /// @return 削除した場合、真です。
+        template<typename Q>
+        Bool Remove(const Q &value) noexcept
+        {
+            const _Internal::LookupKeyType<K, Q, H, E> &lookup = value;
+            auto pSlot = this->m_table.Find(lookup);
+            if (pSlot == nullptr)
+                return false;
+            this->m_table.EraseSlot(pSlot);
+            return true;
+        }
+
+        /// 指定要素数を拡張せずに保持できるよう容量を確保します。
+        /// @param count 要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_table.Reserve(count);
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            this->m_table.Clear();
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_table.begin();
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_table.end();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_HASHSET_HPP
\ No newline at end of file
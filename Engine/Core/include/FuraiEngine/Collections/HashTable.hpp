@@ -0,0 +1,767 @@
+/// @file FuraiEngine/Collections/HashTable.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// オープンアドレス法のハッシュテーブルを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_HASHTABLE_HPP
+#define _FURAIENGINE_COLLECTIONS_HASHTABLE_HPP
+#include <cstring>
+#include <iterator>
+#include <new>
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Hash.hpp"
+#include "FuraiEngine/Memory.hpp"
+#if defined(FURAIENGINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(FURAIENGINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 空きスロットを表す制御バイトです。
+        constexpr U8 CONTROL_EMPTY = 0x80;
+
+        /// 削除済みスロットを表す制御バイトです。
+        constexpr U8 CONTROL_DELETED = 0xFE;
+
+        /// 制御バイトが使用中スロットを表すか判定します。
+        /// 使用中スロットの制御バイトは、ハッシュ値の下位7ビットです。
+        /// @param control 制御バイトです。
+        /// @return 使用中の場合、真です。
+        constexpr Bool IsControlFull(U8 control) noexcept
+        {
+            return (control & 0x80) == 0;
+        }
+
+        /// 制御バイトグループの検索結果のビットマスクです。
+        /// @tparam SHIFT 1スロットあたりのビット数の2の対数です。
+        /// @tparam WIDTH グループのスロット数です。
+        template<U32 SHIFT, U32 WIDTH>
+        class ControlBitMask
+        {
+            U64 m_mask; // 一致したスロットのビットマスクです。
+
+        public:
+            /// 初期化します。
+            /// @param mask ビットマスクです。
+            explicit ControlBitMask(U64 mask) noexcept
+                : m_mask(mask)
+            {}
+
+            /// 一致したスロットが存在するか判定します。
+            /// @return 存在する場合、真です。
+            explicit operator Bool() const noexcept
+            {
+                return this->m_mask != 0;
+            }
+
+            /// 最も下位の一致したスロットの位置を取得します。
+            /// @return グループ内の位置です。
+            U32 LowestBitSet() const noexcept
+            {
+                return CountTrailingZeros(this->m_mask) >> SHIFT;
+            }
+
+            /// 最も下位の一致したスロットを取り除きます。
+            void ClearLowestBit() noexcept
+            {
+                this->m_mask &= this->m_mask - 1;
+            }
+
+            /// 先頭から連続する不一致スロットの数を取得します。
+            /// @return 不一致スロットの数です。
+            U32 TrailingZeros() const noexcept
+            {
+                return CountTrailingZeros(this->m_mask) >> SHIFT;
+            }
+
+            /// 末尾から連続する不一致スロットの数を取得します。
+            /// @return 不一致スロットの数です。
+            U32 LeadingZeros() const noexcept
+            {
+                constexpr U32 UNUSED_BITS = 64 - (WIDTH << SHIFT);
+                return (CountLeadingZeros(this->m_mask) - UNUSED_BITS)
+                    >> SHIFT;
+            }
+        };
+
+#if defined(FURAIENGINE_SIMD_SSE2)
+        /// 制御バイトのグループです。(SSE2)
+        class ControlGroup
+        {
+            __m128i m_controls; // 制御バイトです。
+
+        public:
+            /// グループのスロット数です。
+            static constexpr USize WIDTH = 16;
+
+            /// 検索結果の型です。
+            using BitMaskType = ControlBitMask<0, 16>;
+
+            /// 制御バイトを読み込みます。
+            /// @param pControls 読み込み位置です。
+            explicit ControlGroup(const U8 *pControls) noexcept
+                : m_controls(_mm_loadu_si128((const __m128i *) pControls))
+            {}
+
+            /// 指定値と一致するスロットを検索します。
+            /// @param h2 ハッシュ値の下位7ビットです。
+            /// @return 一致したスロットです。
+            BitMaskType Match(U8 h2) const noexcept
+            {
+                auto match = _mm_set1_epi8((char) h2);
+                return BitMaskType((U32) _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(match, this->m_controls)));
+            }
+
+            /// 空きスロットを検索します。
+            /// @return 空きスロットです。
+            BitMaskType MaskEmpty() const noexcept
+            {
+                auto match = _mm_set1_epi8((char) CONTROL_EMPTY);
+                return BitMaskType((U32) _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(match, this->m_controls)));
+            }
+
+            /// 空き、または、削除済みスロットを検索します。
+            /// @return 空き、または、削除済みスロットです。
+            BitMaskType MaskEmptyOrDeleted() const noexcept
+            {
+                return BitMaskType(
+                    (U32) _mm_movemask_epi8(this->m_controls));
+            }
+        };
+#elif defined(FURAIENGINE_SIMD_NEON)
+        /// 制御バイトのグループです。(NEON)
+        class ControlGroup
+        {
+            uint8x8_t m_controls; // 制御バイトです。
+
+            /// 比較結果をビットマスクに変換します。
+            static U64 _ToMask(uint8x8_t compared) noexcept
+            {
+                return vget_lane_u64(vreinterpret_u64_u8(compared), 0)
+                     & 0x8080808080808080ULL;
+            }
+
+        public:
+            /// グループのスロット数です。
+            static constexpr USize WIDTH = 8;
+
+            /// 検索結果の型です。
+            using BitMaskType = ControlBitMask<3, 8>;
+
+            /// 制御バイトを読み込みます。
+            /// @param pControls 読み込み位置です。
+            explicit ControlGroup(const U8 *pControls) noexcept
+                : m_controls(vld1_u8(pControls))
+            {}
+
+            /// 指定値と一致するスロットを検索します。
+            /// @param h2 ハッシュ値の下位7ビットです。
+            /// @return 一致したスロットです。
+            BitMaskType Match(U8 h2) const noexcept
+            {
+                return BitMaskType(
+                    _ToMask(vceq_u8(this->m_controls, vdup_n_u8(h2))));
+            }
+
+            /// 空きスロットを検索します。
+            /// @return 空きスロットです。
+            BitMaskType MaskEmpty() const noexcept
+            {
+                return BitMaskType(_ToMask(
+                    vceq_u8(this->m_controls, vdup_n_u8(CONTROL_EMPTY))));
+            }
+
+            /// 空き、または、削除済みスロットを検索します。
+            /// @return 空き、または、削除済みスロットです。
+            BitMaskType MaskEmptyOrDeleted() const noexcept
+            {
+                return BitMaskType(vget_lane_u64(
+                    vreinterpret_u64_u8(this->m_controls), 0)
+                    & 0x8080808080808080ULL);
+            }
+        };
+#else
+        /// 制御バイトのグループです。(64ビット整数による汎用実装)
+        class ControlGroup
+        {
+            static constexpr U64 LSBS = 0x0101010101010101ULL; // 各バイトの最下位ビットです。
+            static constexpr U64 MSBS = 0x8080808080808080ULL; // 各バイトの最上位ビットです。
+
+            U64 m_controls; // 制御バイトです。(リトルエンディアン)
+
+        public:
+            /// グループのスロット数です。
+            static constexpr USize WIDTH = 8;
+
+            /// 検索結果の型です。
+            using BitMaskType = ControlBitMask<3, 8>;
+
+            /// 制御バイトを読み込みます。
+            /// @param pControls 読み込み位置です。
+            explicit ControlGroup(const U8 *pControls) noexcept
+            {
+                std::memcpy(&this->m_controls, pControls, sizeof(U64));
+            }
+
+            /// 指定値と一致するスロットを検索します。
+            /// 稀に不一致のスロットを含みますが、キー比較で除外されます。
+            /// @param h2 ハッシュ値の下位7ビットです。
+            /// @return 一致したスロットです。
+            BitMaskType Match(U8 h2) const noexcept
+            {
+                auto x = this->m_controls ^ (LSBS * h2);
+                return BitMaskType((x - LSBS) & ~x & MSBS);
+            }
+
+            /// 空きスロットを検索します。
+            /// @return 空きスロットです。
+            BitMaskType MaskEmpty() const noexcept
+            {
+                return BitMaskType(
+                    (this->m_controls & (~this->m_controls << 6)) & MSBS);
+            }
+
+            /// 空き、または、削除済みスロットを検索します。
+            /// @return 空き、または、削除済みスロットです。
+            BitMaskType MaskEmptyOrDeleted() const noexcept
+            {
+                return BitMaskType(this->m_controls & MSBS);
+            }
+        };
+#endif
+
+        /// ハッシュテーブルのイテレータです。
+        /// @tparam S スロットの型です。
+        template<typename S>
+        class HashTableIterator
+        {
+            S        *m_pSlots;    // スロット配列です。
+            const U8 *m_pControls; // 制御バイト配列です。
+            USize     m_index;     // 現在位置です。
+            USize     m_capacity;  // スロット数です。
+
+            /// 使用中スロットまで進めます。
+            void _SkipEmpty() noexcept
+            {
+                while (this->m_index < this->m_capacity
+                       && !IsControlFull(this->m_pControls[this->m_index]))
+                    this->m_index += 1;
+            }
+
+        public:
+            /// イテレータのカテゴリフラグ型です。
+            using iterator_category = std::forward_iterator_tag;
+
+            /// 要素型の型エイリアスです。
+            using value_type = S;
+
+            /// イテレータの移動距離を表現する為の符号付き整数型の型エイリアスです。
+            using difference_type = ISize;
+
+            /// 要素型のポインタ型エイリアスです。
+            using pointer = S *;
+
+            /// 要素型の参照型エイリアスです。
+            using reference = S &;
+
+            /// 初期化します。
+            /// @param pSlots スロット配列です。
+            /// @param pControls 制御バイト配列です。
+            /// @param index 開始位置です。
+            /// @param capacity スロット数です。
+            HashTableIterator(S        *pSlots,
+                              const U8 *pControls,
+                              USize     index,
+                              USize     capacity) noexcept
+                : m_pSlots(pSlots)
+                , m_pControls(pControls)
+                , m_index(index)
+                , m_capacity(capacity)
+            {
+                this->_SkipEmpty();
+            }
+
+            /// 一つ進めます。
+            HashTableIterator<S> &operator++() noexcept
+            {
+                this->m_index += 1;
+                this->_SkipEmpty();
+                return *this;
+            }
+
+            /// 一つ進めて、進む前のイテレータを返します。
+            /// @return 進める前のイテレータです。
+            HashTableIterator<S> operator++(int) noexcept
+            {
+                auto iter = *this;
+                ++(*this);
+                return iter;
+            }
+
+            /// 要素にアクセスします。
+            /// @return 要素の参照です。
+            S &operator*() const noexcept
+            {
+                return this->m_pSlots[this->m_index];
+            }
+
+            /// 要素にアクセスします。
+            /// @return 要素のポインタです。
+            S *operator->() const noexcept
+            {
+                return &this->m_pSlots[this->m_index];
+            }
+
+            /// 要素が同等か比較します。
+            /// @param other 比較対象です。
+            /// @return 同等の場合、真です。
+            Bool operator==(const HashTableIterator<S> &other) const noexcept
+            {
+                return this->m_index == other.m_index;
+            }
+
+            /// 要素が不等か比較します。
+            /// @param other 比較対象です。
+            /// @return 不等の場合、真です。
+            Bool operator!=(const HashTableIterator<S> &other) const noexcept
+            {
+                return this->m_index != other.m_index;
+            }
+        };
+
+        /// オープンアドレス法のハッシュテーブルです。
+        /// 制御バイトをグループ単位でSIMD比較して探索します。
+        /// @tparam S スロットの型です。
+        /// @tparam K キーの型です。
+        /// @tparam A アロケータの型です。要素型はSです。
+        /// @tparam H ハッシュ関数の型です。
+        /// @tparam E 同等比較関数の型です。
+        /// @tparam X スロットからキーを取り出す型です。
+        template<typename S,
+                 typename K,
+                 typename A,
+                 typename H,
+                 typename E,
+                 typename X>
+        class HashTable
+        {
+            static constexpr USize GROUP_WIDTH = ControlGroup::WIDTH; // グループのスロット数です。
+
+        public:
+            /// スロットの型です。
+            using SlotType = S;
+            /// キーの型です。
+            using KeyType = K;
+            /// アロケータの型です。
+            using AllocatorType = A;
+            /// ハッシュ関数の型です。
+            using HasherType = H;
+            /// 同等比較関数の型です。
+            using EqualType = E;
+            /// 可変イテレータの型です。
+            using IteratorType = HashTableIterator<S>;
+            /// 不変イテレータの型です。
+            using ConstIteratorType = HashTableIterator<const S>;
+
+        private:
+            USize         m_capacity;       // スロット数です。(2の累乗)
+            USize         m_elementsCount;  // 使用中のスロット数です。
+            USize         m_growthLeft;     // 拡張せずに追加できる要素数です。
+            USize         m_allocatedCount; // 確保した要素数です。
+            AllocatorType m_allocator;
+            HasherType    m_hasher;
+            EqualType     m_equal;
+            SlotType     *m_pSlots;
+            U8           *m_pControls;
+
+            /// 容量から、拡張せずに保持できる要素数を計算します。(負荷率7/8)
+            /// @param capacity 容量です。
+            /// @return 保持できる要素数です。
+            static USize _CapacityToGrowth(USize capacity) noexcept
+            {
+                return capacity - capacity / 8;
+            }
+
+            /// ハッシュ値を計算します。
+            /// @param key キーです。
+            /// @return 攪拌したハッシュ値です。
+            template<typename Q>
+            USize _HashOf(const Q &key) const noexcept
+            {
+                return (USize) MixHash((U64) this->m_hasher(key));
+            }
+
+            /// 制御バイトを設定します。
+            /// 先頭グループ分は末尾の複製領域にも設定します。
+            /// @param index スロット位置です。
+            /// @param control 制御バイトです。
+            void _SetControl(USize index, U8 control) noexcept
+            {
+                this->m_pControls[index] = control;
+                if (index < GROUP_WIDTH)
+                    this->m_pControls[this->m_capacity + index] = control;
+            }
+
+            /// 挿入可能なスロットを探索します。
+            /// @param hash ハッシュ値です。
+            /// @return スロット位置です。
+            USize _FindInsertPosition(USize hash) const noexcept
+            {
+                auto  mask  = this->m_capacity - 1;
+                auto  pos   = (hash >> 7) & mask;
+                USize index = 0;
+                while (true)
+                {
+                    ControlGroup group(this->m_pControls + pos);
+                    if (auto m = group.MaskEmptyOrDeleted())
+                        return (pos + m.LowestBitSet()) & mask;
+                    index += GROUP_WIDTH;
+                    pos = (pos + index) & mask;
+                }
+            }
+
+            /// 容量を変更し、全要素を再配置します。
+            /// @param capacity 新しい容量です。(2の累乗)
+            void _Resize(USize capacity) noexcept
+            {
+                auto pOldSlots      = this->m_pSlots;
+                auto pOldControls   = this->m_pControls;
+                auto oldCapacity    = this->m_capacity;
+                auto oldAllocated   = this->m_allocatedCount;
+                auto controlsCount  = capacity + GROUP_WIDTH;
+                auto controlsInSlot = (controlsCount + sizeof(SlotType) - 1)
+                                    / sizeof(SlotType);
+
+                this->m_allocatedCount = capacity + controlsInSlot;
+                if (!this->m_allocator
+                         .Allocate(this->m_allocatedCount)
+                         .IsSuccess(this->m_pSlots))
+                {
+                    LogError(TXT("メモリの確保に失敗しました。"
+                                 "'HashTable<{}>::_Resize(USize capacity) "
+                                 "noexcept'"),
+                             TypenameOf<S>());
+
+                    ExitError();
+                }
+                this->m_capacity  = capacity;
+                this->m_pControls = (U8 *) (this->m_pSlots + capacity);
+                std::memset(this->m_pControls, CONTROL_EMPTY, controlsCount);
+                this->m_growthLeft = _CapacityToGrowth(capacity)
+                                   - this->m_elementsCount;
+
+                if (pOldSlots == nullptr)
+                    return;
+
+                // 再配置します。
+                for (USize i = 0; i < oldCapacity; i++)
+                {
+                    if (!IsControlFull(pOldControls[i]))
+                        continue;
+                    auto hash = this->_HashOf(X::KeyOf(pOldSlots[i]));
+                    auto pos  = this->_FindInsertPosition(hash);
+                    this->_SetControl(pos, (U8) (hash & 0x7F));
+                    new (&this->m_pSlots[pos])
+                        SlotType(Move(pOldSlots[i]));
+                    pOldSlots[i].~SlotType();
+                }
+                static_cast<void>(
+                    this->m_allocator.Deallocate(pOldSlots, oldAllocated));
+            }
+
+            /// 要素を1つ追加できるように必要なら拡張します。
+            void _PrepareGrowth() noexcept
+            {
+                if (this->m_capacity == 0)
+                    this->_Resize(GROUP_WIDTH);
+                else if (this->m_elementsCount
+                         <= _CapacityToGrowth(this->m_capacity) / 2)
+                    this->_Resize(this->m_capacity); // 削除済みを掃除します。
+                else
+                    this->_Resize(this->m_capacity * 2);
+            }
+
+            /// 全要素を解体します。
+            void _DestroyAll() noexcept
+            {
+                for (USize i = 0; i < this->m_capacity; i++)
+                {
+                    if (IsControlFull(this->m_pControls[i]))
+                        this->m_pSlots[i].~SlotType();
+                }
+            }
+
+            /// 確保したメモリを解放します。
+            void _Release() noexcept
+            {
+                if (this->m_pSlots == nullptr)
+                    return;
+                this->_DestroyAll();
+                static_cast<void>(this->m_allocator.Deallocate(
+                    this->m_pSlots, this->m_allocatedCount));
+                this->m_pSlots    = nullptr;
+                this->m_pControls = nullptr;
+            }
+
+        public:
+            /// 初期化します。メモリは最初の追加時に確保します。
+            /// @param allocator アロケータです。
+            HashTable(const AllocatorType &allocator = AllocatorType()) noexcept
+                : m_capacity(0)
+                , m_elementsCount(0)
+                , m_growthLeft(0)
+                , m_allocatedCount(0)
+                , m_allocator(allocator)
+                , m_hasher()
+                , m_equal()
+                , m_pSlots(nullptr)
+                , m_pControls(nullptr)
+            {}
+
+            /// ムーブします。
+            /// @param origin ムーブ元です。
+            HashTable(HashTable &&origin) noexcept
+                : m_capacity(origin.m_capacity)
+                , m_elementsCount(origin.m_elementsCount)
+                , m_growthLeft(origin.m_growthLeft)
+                , m_allocatedCount(origin.m_allocatedCount)
+                , m_allocator(Move(origin.m_allocator))
+                , m_hasher(Move(origin.m_hasher))
+                , m_equal(Move(origin.m_equal))
+                , m_pSlots(origin.m_pSlots)
+                , m_pControls(origin.m_pControls)
+            {
+                origin.m_capacity      = 0;
+                origin.m_elementsCount = 0;
+                origin.m_growthLeft    = 0;
+                origin.m_pSlots        = nullptr;
+                origin.m_pControls     = nullptr;
+            }
+
+            /// ムーブ代入します。
+            /// @param origin ムーブ元です。
+            /// @return 自身のインスタンスです。
+            HashTable &operator=(HashTable &&origin) noexcept
+            {
+                if (this != &origin)
+                {
+                    this->_Release();
+                    this->m_capacity       = origin.m_capacity;
+                    this->m_elementsCount  = origin.m_elementsCount;
+                    this->m_growthLeft     = origin.m_growthLeft;
+                    this->m_allocatedCount = origin.m_allocatedCount;
+                    this->m_allocator      = Move(origin.m_allocator);
+                    this->m_hasher         = Move(origin.m_hasher);
+                    this->m_equal          = Move(origin.m_equal);
+                    this->m_pSlots         = origin.m_pSlots;
+                    this->m_pControls      = origin.m_pControls;
+                    origin.m_capacity      = 0;
+                    origin.m_elementsCount = 0;
+                    origin.m_growthLeft    = 0;
+                    origin.m_pSlots        = nullptr;
+                    origin.m_pControls     = nullptr;
+                }
+                return *this;
+            }
+
+            HashTable(const HashTable &)            = delete;
+            HashTable &operator=(const HashTable &) = delete;
+
+            /// 解体します。
+            ~HashTable() noexcept
+            {
+                this->_Release();
+            }
+
+            /// 要素数を取得します。
+            /// @return 要素数です。
+            USize Count() const noexcept
+            {
+                return this->m_elementsCount;
+            }
+
+            /// 容量を取得します。
+            /// @return スロット数です。
+            USize Capacity() const noexcept
+            {
+                return this->m_capacity;
+            }
+
+            /// キーを検索します。
+            /// @tparam Q キーと比較可能な型です。
+            /// @param key 検索するキーです。
+            /// @return 見つかったスロット、または、ヌルです。
+            template<typename Q>
+            SlotType *Find(const Q &key) noexcept
+            {
+                return const_cast<SlotType *>(
+                    static_cast<const HashTable *>(this)->Find(key));
+            }
+
+            /// キーを検索します。
+            /// @tparam Q キーと比較可能な型です。
+            /// @param key 検索するキーです。
+            /// @return 見つかったスロット、または、ヌルです。
+            template<typename Q>
+            const SlotType *Find(const Q &key) const noexcept
+            {
+                if (this->m_elementsCount == 0)
+                    return nullptr;
+
+                auto  hash  = this->_HashOf(key);
+                auto  h2    = (U8) (hash & 0x7F);
+                auto  mask  = this->m_capacity - 1;
+                auto  pos   = (hash >> 7) & mask;
+                USize index = 0;
+                while (true)
+                {
+                    ControlGroup group(this->m_pControls + pos);
+                    for (auto m = group.Match(h2); m; m.ClearLowestBit())
+                    {
+                        auto i = (pos + m.LowestBitSet()) & mask;
+                        if (this->m_equal(X::KeyOf(this->m_pSlots[i]), key))
+                            return &this->m_pSlots[i];
+                    }
+                    if (group.MaskEmpty())
+                        return nullptr;
+                    index += GROUP_WIDTH;
+                    pos = (pos + index) & mask;
+                }
+            }
+
+            /// キーを検索し、無ければ挿入位置を確保します。
+            /// 挿入位置を確保した場合、呼び出し側でスロットを構築する必要があります。
+            /// @tparam Q キーと比較可能な型です。
+            /// @param key 検索するキーです。
+            /// @param isInserted 挿入位置を確保した場合、真を受け取ります。
+            /// @return 見つかったスロット、または、未構築のスロットです。
+            template<typename Q>
+            SlotType *FindOrPrepareInsert(const Q &key,
+                                          Bool    &isInserted) noexcept
+            {
+                if (auto pSlot = this->Find(key))
+                {
+                    isInserted = false;
+                    return pSlot;
+                }
+
+                auto hash = this->_HashOf(key);
+                if (this->m_growthLeft == 0)
+                    this->_PrepareGrowth();
+                auto pos = this->_FindInsertPosition(hash);
+                if (this->m_pControls[pos] == CONTROL_EMPTY)
+                    this->m_growthLeft -= 1;
+                this->_SetControl(pos, (U8) (hash & 0x7F));
+                this->m_elementsCount += 1;
+                isInserted = true;
+                return &this->m_pSlots[pos];
+            }
+
+            /// スロットを削除します。
+            /// @param pSlot Find等で取得したスロットです。
+            void EraseSlot(SlotType *pSlot) noexcept
+            {
+                auto index       = (USize) (pSlot - this->m_pSlots);
+                auto mask        = this->m_capacity - 1;
+                auto indexBefore = (index - GROUP_WIDTH) & mask;
+                auto emptyAfter  = ControlGroup(this->m_pControls + index)
+                                      .MaskEmpty();
+                auto emptyBefore =
+                    ControlGroup(this->m_pControls + indexBefore).MaskEmpty();
+
+                // 前後の空きスロットの間隔がグループ幅未満であれば、
+                // このスロットを通過して探索が続くことはありません。
+                auto wasNeverFull =
+                    emptyBefore && emptyAfter
+                    && (emptyAfter.TrailingZeros()
+                        + emptyBefore.LeadingZeros())
+                           < GROUP_WIDTH;
+
+                pSlot->~SlotType();
+                this->m_elementsCount -= 1;
+                if (wasNeverFull)
+                {
+                    this->_SetControl(index, CONTROL_EMPTY);
+                    this->m_growthLeft += 1;
+                }
+                else
+                {
+                    this->_SetControl(index, CONTROL_DELETED);
+                }
+            }
+
+            /// 指定要素数を拡張せずに保持できるよう容量を確保します。
+            /// @param count 要素数です。
+            void Reserve(USize count) noexcept
+            {
+                auto capacity = (USize) NextPowerOfTwo(count + count / 7 + 1);
+                if (capacity < GROUP_WIDTH)
+                    capacity = GROUP_WIDTH;
+                if (capacity > this->m_capacity)
+                    this->_Resize(capacity);
+            }
+
+            /// 全要素を削除します。確保済みのメモリは保持します。
+            void Clear() noexcept
+            {
+                if (this->m_pSlots == nullptr)
+                    return;
+                this->_DestroyAll();
+                std::memset(this->m_pControls,
+                            CONTROL_EMPTY,
+                            this->m_capacity + GROUP_WIDTH);
+                this->m_elementsCount = 0;
+                this->m_growthLeft    = _CapacityToGrowth(this->m_capacity);
+            }
+
+            /// 先頭のイテレータを取得します。
+            /// @return 先頭のイテレータです。
+            IteratorType begin() noexcept
+            {
+                return IteratorType(this->m_pSlots,
+                                    this->m_pControls,
+                                    0,
+                                    this->m_capacity);
+            }
+
+            /// 終端のイテレータを取得します。
+            /// @return 終端のイテレータです。
+            IteratorType end() noexcept
+            {
+                return IteratorType(this->m_pSlots,
+                                    this->m_pControls,
+                                    this->m_capacity,
+                                    this->m_capacity);
+            }
+
+            /// 先頭の不変イテレータを取得します。
+            /// @return 先頭の不変イテレータです。
+            ConstIteratorType begin() const noexcept
+            {
+                return ConstIteratorType(this->m_pSlots,
+                                         this->m_pControls,
+                                         0,
+                                         this->m_capacity);
+            }
+
+            /// 終端の不変イテレータを取得します。
+            /// @return 終端の不変イテレータです。
+            ConstIteratorType end() const noexcept
+            {
+                return ConstIteratorType(this->m_pSlots,
+                                         this->m_pControls,
+                                         this->m_capacity,
+                                         this->m_capacity);
+            }
+        };
+    }
+    /// @endcond
+}
+#endif // !_FURAIENGINE_COLLECTIONS_HASHTABLE_HPP
\ No newline at end of file
@@ -0,0 +1,275 @@
+/// @file FuraiEngine/Collections/IntrusiveHashTable.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 侵入型のチェイン法ハッシュテーブルを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_INTRUSIVEHASHTABLE_HPP
+#define _FURAIENGINE_COLLECTIONS_INTRUSIVEHASHTABLE_HPP
+#include "FuraiEngine/Collections/Array.hpp"
+#include "FuraiEngine/Collections/IntrusiveList.hpp"
+#include "FuraiEngine/Hash.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 侵入型ハッシュテーブルのフックです。
+    /// テーブルに繋ぐオブジェクトのメンバとして持たせます。
+    class IntrusiveHashHook
+    {
+        template<typename K,
+                 typename T,
+                 K T::*KEY,
+                 IntrusiveHashHook T::*HOOK,
+                 typename H,
+                 typename E>
+        friend class IntrusiveHashTable;
+
+        IntrusiveHashHook *m_pNext; // 同じバケットの次のフックです。
+        USize              m_hash;  // キャッシュしたハッシュ値です。
+
+    public:
+        /// 初期化します。
+        IntrusiveHashHook() noexcept
+            : m_pNext(nullptr)
+            , m_hash(0)
+        {
+        }
+
+        /// 複製します。テーブルへの接続は複製しません。
+        IntrusiveHashHook(const IntrusiveHashHook &) noexcept
+            : m_pNext(nullptr)
+            , m_hash(0)
+        {
+        }
+
+        /// 代入します。テーブルへの接続は変更しません。
+        /// @return 自身のインスタンスです。
+        IntrusiveHashHook &operator=(const IntrusiveHashHook &) noexcept
+        {
+            return *this;
+        }
+    };
+
+    /// 侵入型のチェイン法ハッシュテーブルです。
+    /// 要素の所有権を持たず、ノードのメモリ確保も行いません。(バケット配列のみ確保します)
+    /// キーは要素のメンバで、繋いでいる間は変更できません。
+    /// @tparam K キーの型です。
+    /// @tparam T 要素の型です。
+    /// @tparam KEY 要素内のキーのメンバポインタです。
+    /// @tparam HOOK 要素内のフックのメンバポインタです。
+    /// @tparam H ハッシュ関数の型です。
+    /// @tparam E 等価比較関数の型です。
+    /// @warning 要素はテーブルから取り除いてから解体してください。
+    template<typename K,
+             typename T,
+             K T::*KEY,
+             IntrusiveHashHook T::*HOOK,
+             typename H = Hash<K>,
+             typename E = EqualTo<K>>
+    class IntrusiveHashTable
+    {
+        static constexpr USize BUCKETS_COUNT_MIN = 16; // バケット数の最小値です。
+
+    public:
+        /// キーの型です。
+        using KeyType = K;
+        /// 要素の型です。
+        using ElementType = T;
+        /// ハッシュ関数の型です。
+        using HasherType = H;
+        /// 等価比較関数の型です。
+        using EqualType = E;
+
+    private:
+        Array<IntrusiveHashHook *> m_buckets; // バケットごとの先頭のフックです。(2の累乗個)
+        USize                      m_count;   // 要素数です。
+        HasherType                 m_hasher;
+        EqualType                  m_equal;
+
+        /// フックから要素を取得します。
+        static T *_OwnerOf(IntrusiveHashHook *pHook) noexcept
+        {
+            return _Internal::IntrusiveOwnerOf<T, IntrusiveHashHook, HOOK>(pHook);
+        }
+
+        /// ハッシュ値からバケットの位置を計算します。
+        USize _BucketOf(USize hash) const noexcept
+        {
+            return MixHash(hash) & (this->m_buckets.Count() - 1);
+        }
+
+        /// バケット数を変更し、要素を繋ぎ直します。
+        /// @param count 新しいバケット数です。(2の累乗)
+        void _Rehash(USize count) noexcept
+        {
+            Array<IntrusiveHashHook *> buckets(count);
+            buckets.Resize(count, nullptr);
+            auto mask = count - 1;
+            for (USize i = 0; i < this->m_buckets.Count(); i++)
+            {
+                auto pHook = this->m_buckets[i];
+                while (pHook != nullptr)
+                {
+                    auto  pNext    = pHook->m_pNext;
+                    auto &bucket   = buckets[MixHash(pHook->m_hash) & mask];
+                    pHook->m_pNext = bucket;
+                    bucket         = pHook;
+                    pHook          = pNext;
+                }
+            }
+            this->m_buckets = Move(buckets);
+        }
+
+    public:
+        /// 初期化します。
+        /// @param hasher ハッシュ関数です。
+        /// @param equal 等価比較関数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        IntrusiveHashTable(const HasherType &hasher = HasherType(),
+                           const EqualType  &equal  = EqualType()) noexcept
+            : m_buckets(BUCKETS_COUNT_MIN)
+            , m_count(0)
+            , m_hasher(hasher)
+            , m_equal(equal)
+        {
+            this->m_buckets.Resize(BUCKETS_COUNT_MIN, nullptr);
+        }
+
+        IntrusiveHashTable(const IntrusiveHashTable &)            = delete;
+        IntrusiveHashTable &operator=(const IntrusiveHashTable &) = delete;
+
+        /// 解体します。すべての要素を切り離します。
+        ~IntrusiveHashTable() noexcept
+        {
+            this->Clear();
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 要素を繋ぎます。
+        /// 要素数がバケット数を超えた場合、バケット数を2倍にします。
+        /// @param element 繋ぐ要素です。他のテーブルに繋がれていない必要があります。
+        /// @return 繋いだ場合、真です。同じキーが既に存在する場合、偽です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        Bool Add(ElementType &element) noexcept
+        {
+            if (this->Find(element.*KEY) != nullptr)
+                return false;
+            if (this->m_count + 1 > this->m_buckets.Count())
+                this->_Rehash(this->m_buckets.Count() * 2);
+            auto pHook     = &(element.*HOOK);
+            pHook->m_hash  = this->m_hasher(element.*KEY);
+            auto &bucket   = this->m_buckets[this->_BucketOf(pHook->m_hash)];
+            pHook->m_pNext = bucket;
+            bucket         = pHook;
+            this->m_count += 1;
+            return true;
+        }
+
+        /// キーに対応する要素を検索します。
+        /// @param key キーです。
+        /// @return 要素のポインタです。見つからない場合、nullptrです。
+        ElementType *Find(const KeyType &key) const noexcept
+        {
+            auto hash  = this->m_hasher(key);
+            auto pHook = this->m_buckets[this->_BucketOf(hash)];
+            for (; pHook != nullptr; pHook = pHook->m_pNext)
+            {
+                if (pHook->m_hash != hash)
+                    continue;
+                auto pElement = _OwnerOf(pHook);
+                if (this->m_equal(pElement->*KEY, key))
+                    return pElement;
+            }
+            return nullptr;
+        }
+
+        /// キーが含まれるか判定します。
+        /// @param key キーです。
+        /// @return 含まれる場合、真です。
+        Bool Contains(const KeyType &key) const noexcept
+        {
+            return this->Find(key) != nullptr;
+        }
+
+        /// キーに対応する要素を切り離します。
+        /// @param key キーです。
+        /// @return 切り離した要素のポインタです。見つからない場合、nullptrです。
+        ElementType *Remove(const KeyType &key) noexcept
+        {
+            auto hash   = this->m_hasher(key);
+            auto ppLink = &this->m_buckets[this->_BucketOf(hash)];
+            for (; *ppLink != nullptr; ppLink = &(*ppLink)->m_pNext)
+            {
+                auto pHook = *ppLink;
+                if (pHook->m_hash != hash)
+                    continue;
+                auto pElement = _OwnerOf(pHook);
+                if (!this->m_equal(pElement->*KEY, key))
+                    continue;
+                *ppLink        = pHook->m_pNext;
+                pHook->m_pNext = nullptr;
+                this->m_count -= 1;
+                return pElement;
+            }
+            return nullptr;
+        }
+
+        /// 要素を切り離します。
+        /// @param element このテーブルに繋がれている要素です。
+        void Remove(ElementType &element) noexcept
+        {
+            auto pTarget = &(element.*HOOK);
+            auto ppLink  = &this->m_buckets[this->_BucketOf(pTarget->m_hash)];
+            while (*ppLink != pTarget)
+                ppLink = &(*ppLink)->m_pNext;
+            *ppLink          = pTarget->m_pNext;
+            pTarget->m_pNext = nullptr;
+            this->m_count -= 1;
+        }
+
+        /// すべての要素を切り離します。
+        void Clear() noexcept
+        {
+            for (USize i = 0; i < this->m_buckets.Count(); i++)
+            {
+                auto pHook = this->m_buckets[i];
+                while (pHook != nullptr)
+                {
+                    auto pNext     = pHook->m_pNext;
+                    pHook->m_pNext = nullptr;
+                    pHook          = pNext;
+                }
+                this->m_buckets[i] = nullptr;
+            }
+            this->m_count = 0;
+        }
+
+        /// すべての要素を関数に渡します。
+        /// @param func 要素の参照を受け取る関数です。
+        template<typename F>
+        void ForEach(F &&func) const noexcept
+        {
+            for (USize i = 0; i < this->m_buckets.Count(); i++)
+            {
+                for (auto pHook = this->m_buckets[i]; pHook != nullptr;)
+                {
+                    auto pNext = pHook->m_pNext; // 関数内で切り離されても継続します。
+                    func(*_OwnerOf(pHook));
+                    pHook = pNext;
+                }
+            }
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_INTRUSIVEHASHTABLE_HPP
\ No newline at end of file
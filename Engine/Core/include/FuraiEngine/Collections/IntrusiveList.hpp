@@ -0,0 +1,415 @@
+/// @file FuraiEngine/Collections/IntrusiveList.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 侵入型の双方向連結リストを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_INTRUSIVELIST_HPP
+#define _FURAIENGINE_COLLECTIONS_INTRUSIVELIST_HPP
+#include <iterator>
+#include "FuraiEngine/Primitive.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// フックのメンバポインタから、フックを含むオブジェクトを計算します。
+        /// @tparam T オブジェクトの型です。
+        /// @tparam H フックの型です。
+        /// @tparam HOOK オブジェクト内のフックのメンバポインタです。
+        /// @param pHook フックのポインタです。
+        /// @return オブジェクトのポインタです。
+        template<typename T, typename H, H T::*HOOK>
+        T *IntrusiveOwnerOf(H *pHook) noexcept
+        {
+            // 整列済みの仮の番地からメンバの位置を求めます。(offsetofと同等です)
+            constexpr USize BASE = 0x1000;
+            auto offset = (USize) &(((T *) BASE)->*HOOK) - BASE;
+            return (T *) ((U8 *) pHook - offset);
+        }
+    }
+    /// @endcond
+
+    /// 侵入型の双方向連結リストのフックです。
+    /// リストに繋ぐオブジェクトのメンバとして持たせます。
+    /// 同じオブジェクトを複数のリストへ繋ぐ場合、リストごとにフックを持たせます。
+    class IntrusiveListHook
+    {
+        template<typename T, IntrusiveListHook T::*HOOK>
+        friend class IntrusiveList;
+        template<typename T, IntrusiveListHook T::*HOOK>
+        friend class IntrusiveListIterator;
+
+        IntrusiveListHook *m_pPrevious; // 前のフックです。
+        IntrusiveListHook *m_pNext;     // 次のフックです。
+
+    public:
+        /// 初期化します。
+        IntrusiveListHook() noexcept
+            : m_pPrevious(nullptr)
+            , m_pNext(nullptr)
+        {
+        }
+
+        /// 複製します。リストへの接続は複製しません。
+        IntrusiveListHook(const IntrusiveListHook &) noexcept
+            : m_pPrevious(nullptr)
+            , m_pNext(nullptr)
+        {
+        }
+
+        /// 代入します。リストへの接続は変更しません。
+        /// @return 自身のインスタンスです。
+        IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept
+        {
+            return *this;
+        }
+
+        /// リストに繋がれているか判定します。
+        /// @return 繋がれている場合、真です。
+        Bool IsLinked() const noexcept
+        {
+            return this->m_pNext != nullptr;
+        }
+    };
+
+    /// 侵入型の双方向連結リストのイテレータです。
+    /// @tparam T 要素の型です。
+    /// @tparam HOOK 要素内のフックのメンバポインタです。
+    template<typename T, IntrusiveListHook T::*HOOK>
+    class IntrusiveListIterator
+    {
+        IntrusiveListHook *m_pHook; // 現在のフックです。
+
+    public:
+        /// イテレータのカテゴリフラグ型です。
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /// 要素型の型エイリアスです。
+        using value_type = T;
+
+        /// イテレータの移動距離を表現する為の符号付き整数型の型エイリアスです。
+        using difference_type = ISize;
+
+        /// 要素型のポインタ型エイリアスです。
+        using pointer = T *;
+
+        /// 要素型の参照型エイリアスです。
+        using reference = T &;
+
+        /// 初期化します。
+        /// @param pHook 指し示すフックです。
+        explicit IntrusiveListIterator(IntrusiveListHook *pHook) noexcept
+            : m_pHook(pHook)
+        {
+        }
+
+        /// 一つ進めます。
+        IntrusiveListIterator<T, HOOK> &operator++() noexcept
+        {
+            this->m_pHook = this->m_pHook->m_pNext;
+            return *this;
+        }
+
+        /// 一つ進めて、進む前のイテレータを返します。
+        /// @return 進める前のイテレータです。
+        IntrusiveListIterator<T, HOOK> operator++(int) noexcept
+        {
+            auto iter = *this;
+            ++(*this);
+            return iter;
+        }
+
+        /// 一つ戻します。
+        IntrusiveListIterator<T, HOOK> &operator--() noexcept
+        {
+            this->m_pHook = this->m_pHook->m_pPrevious;
+            return *this;
+        }
+
+        /// 一つ戻して、戻す前のイテレータを返します。
+        /// @return 戻す前のイテレータです。
+        IntrusiveListIterator<T, HOOK> operator--(int) noexcept
+        {
+            auto iter = *this;
+            --(*this);
+            return iter;
+        }
+
+        /// 要素にアクセスします。
+        /// @return 要素の参照です。
+        T &operator*() const noexcept
+        {
+            return *_Internal::IntrusiveOwnerOf<T, IntrusiveListHook, HOOK>(
+                this->m_pHook);
+        }
+
+        /// 要素のメンバにアクセスします。
+        /// @return 要素のポインタです。
+        T *operator->() const noexcept
+        {
+            return _Internal::IntrusiveOwnerOf<T, IntrusiveListHook, HOOK>(
+                this->m_pHook);
+        }
+
+        /// 等価比較します。
+        /// @param other 比較対象です。
+        /// @return 等価の場合、真です。
+        Bool operator==(const IntrusiveListIterator<T, HOOK> &other) const noexcept
+        {
+            return this->m_pHook == other.m_pHook;
+        }
+
+        /// 非等価比較します。
+        /// @param other 比較対象です。
+        /// @return 非等価の場合、真です。
+        Bool operator!=(const IntrusiveListIterator<T, HOOK> &other) const noexcept
+        {
+            return this->m_pHook != other.m_pHook;
+        }
+    };
+
+    /// 侵入型の双方向連結リストです。
+    /// 要素の所有権を持たず、ノードのメモリ確保も行いません。
+    /// メモリプール上のオブジェクトを、LRUリストや待ち行列に追加の確保なしで繋ぐ為に使用します。
+    /// @tparam T 要素の型です。
+    /// @tparam HOOK 要素内のフックのメンバポインタです。
+    /// @warning 要素はリストから取り除いてから解体してください。
+    template<typename T, IntrusiveListHook T::*HOOK>
+    class IntrusiveList
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// イテレータの型です。
+        using IteratorType = IntrusiveListIterator<T, HOOK>;
+
+    private:
+        IntrusiveListHook m_root;  // 先頭と末尾を繋ぐ番兵です。
+        USize             m_count; // 要素数です。
+
+        /// 要素のフックを取得します。
+        static IntrusiveListHook *_HookOf(T &element) noexcept
+        {
+            return &(element.*HOOK);
+        }
+
+        /// フックを指定位置の前へ繋ぎます。
+        /// @param pPosition 挿入位置のフックです。
+        /// @param pHook 繋ぐフックです。
+        void _LinkBefore(IntrusiveListHook *pPosition,
+                         IntrusiveListHook *pHook) noexcept
+        {
+            pHook->m_pPrevious              = pPosition->m_pPrevious;
+            pHook->m_pNext                  = pPosition;
+            pPosition->m_pPrevious->m_pNext = pHook;
+            pPosition->m_pPrevious          = pHook;
+            this->m_count += 1;
+        }
+
+        /// フックを切り離します。
+        /// @param pHook 切り離すフックです。
+        void _Unlink(IntrusiveListHook *pHook) noexcept
+        {
+            pHook->m_pPrevious->m_pNext = pHook->m_pNext;
+            pHook->m_pNext->m_pPrevious = pHook->m_pPrevious;
+            pHook->m_pPrevious          = nullptr;
+            pHook->m_pNext              = nullptr;
+            this->m_count -= 1;
+        }
+
+        /// 他のリストの要素を引き取ります。
+        /// @param origin 引き取り元です。
+        void _Take(IntrusiveList<T, HOOK> &origin) noexcept
+        {
+            if (origin.m_count == 0)
+                return;
+            this->m_root.m_pNext              = origin.m_root.m_pNext;
+            this->m_root.m_pPrevious          = origin.m_root.m_pPrevious;
+            this->m_root.m_pNext->m_pPrevious = &this->m_root;
+            this->m_root.m_pPrevious->m_pNext = &this->m_root;
+            this->m_count                     = origin.m_count;
+            origin.m_root.m_pNext             = &origin.m_root;
+            origin.m_root.m_pPrevious         = &origin.m_root;
+            origin.m_count                    = 0;
+        }
+
+    public:
+        /// 初期化します。
+        IntrusiveList() noexcept
+            : m_root()
+            , m_count(0)
+        {
+            this->m_root.m_pPrevious = &this->m_root;
+            this->m_root.m_pNext     = &this->m_root;
+        }
+
+        IntrusiveList(const IntrusiveList<T, HOOK> &)                = delete;
+        IntrusiveList<T, HOOK> &operator=(const IntrusiveList<T, HOOK> &) = delete;
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        IntrusiveList(IntrusiveList<T, HOOK> &&origin) noexcept
+            : IntrusiveList()
+        {
+            this->_Take(origin);
+        }
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        IntrusiveList<T, HOOK> &operator=(IntrusiveList<T, HOOK> &&origin) noexcept
+        {
+            if (this != &origin)
+            {
+                this->Clear();
+                this->_Take(origin);
+            }
+            return *this;
+        }
+
+        /// 解体します。すべての要素を切り離します。
+        ~IntrusiveList() noexcept
+        {
+            this->Clear();
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 先頭の要素を取得します。
+        /// @return 先頭の要素です。
+        /// @warning 空の場合は呼び出せません。
+        ElementType &Front() noexcept
+        {
+            return *IteratorType(this->m_root.m_pNext);
+        }
+
+        /// 末尾の要素を取得します。
+        /// @return 末尾の要素です。
+        /// @warning 空の場合は呼び出せません。
+        ElementType &Back() noexcept
+        {
+            return *IteratorType(this->m_root.m_pPrevious);
+        }
+
+        /// 先頭に要素を繋ぎます。
+        /// @param element 繋ぐ要素です。他のリストに繋がれていない必要があります。
+        void PushFront(ElementType &element) noexcept
+        {
+            this->_LinkBefore(this->m_root.m_pNext, _HookOf(element));
+        }
+
+        /// 末尾に要素を繋ぎます。
+        /// @param element 繋ぐ要素です。他のリストに繋がれていない必要があります。
+        void PushBack(ElementType &element) noexcept
+        {
+            this->_LinkBefore(&this->m_root, _HookOf(element));
+        }
+
+        /// 指定位置の前に要素を繋ぎます。
+        /// @param position 挿入位置の要素です。
+        /// @param element 繋ぐ要素です。他のリストに繋がれていない必要があります。
+        void InsertBefore(ElementType &position, ElementType &element) noexcept
+        {
+            this->_LinkBefore(_HookOf(position), _HookOf(element));
+        }
+
+        /// 先頭の要素を切り離します。
+        /// @return 切り離した要素のポインタです。空の場合、nullptrです。
+        ElementType *PopFront() noexcept
+        {
+            if (this->m_count == 0)
+                return nullptr;
+            auto &element = this->Front();
+            this->_Unlink(_HookOf(element));
+            return &element;
+        }
+
+        /// 末尾の要素を切り離します。
+        /// @return 切り離した要素のポインタです。空の場合、nullptrです。
+        ElementType *PopBack() noexcept
+        {
+            if (this->m_count == 0)
+                return nullptr;
+            auto &element = this->Back();
+            this->_Unlink(_HookOf(element));
+            return &element;
+        }
+
+        /// 要素を切り離します。
+        /// @param element このリストに繋がれている要素です。
+        void Remove(ElementType &element) noexcept
+        {
+            this->_Unlink(_HookOf(element));
+        }
+
+        /// 要素を先頭へ移動させます。LRUの更新に使用します。
+        /// @param element このリストに繋がれている要素です。
+        void MoveToFront(ElementType &element) noexcept
+        {
+            auto pHook = _HookOf(element);
+            this->_Unlink(pHook);
+            this->_LinkBefore(this->m_root.m_pNext, pHook);
+        }
+
+        /// 要素を末尾へ移動させます。
+        /// @param element このリストに繋がれている要素です。
+        void MoveToBack(ElementType &element) noexcept
+        {
+            auto pHook = _HookOf(element);
+            this->_Unlink(pHook);
+            this->_LinkBefore(&this->m_root, pHook);
+        }
+
+        /// すべての要素を切り離します。
+        void Clear() noexcept
+        {
+            auto pHook = this->m_root.m_pNext;
+            while (pHook != &this->m_root)
+            {
+                auto pNext         = pHook->m_pNext;
+                pHook->m_pPrevious = nullptr;
+                pHook->m_pNext     = nullptr;
+                pHook              = pNext;
+            }
+            this->m_root.m_pPrevious = &this->m_root;
+            this->m_root.m_pNext     = &this->m_root;
+            this->m_count            = 0;
+        }
+
+        /// 要素を指すイテレータを取得します。
+        /// @param element このリストに繋がれている要素です。
+        /// @return イテレータです。
+        IteratorType IteratorOf(ElementType &element) noexcept
+        {
+            return IteratorType(_HookOf(element));
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() noexcept
+        {
+            return IteratorType(this->m_root.m_pNext);
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() noexcept
+        {
+            return IteratorType(&this->m_root);
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_INTRUSIVELIST_HPP
\ No newline at end of file
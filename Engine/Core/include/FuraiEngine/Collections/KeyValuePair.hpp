@@ -0,0 +1,61 @@
+/// @file FuraiEngine/Collections/KeyValuePair.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// キーと値の組を提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_KEYVALUEPAIR_HPP
+#define _FURAIENGINE_COLLECTIONS_KEYVALUEPAIR_HPP
+#include "FuraiEngine/Utility.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// キーと値の組です。
+    /// @tparam K キーの型です。
+    /// @tparam V 値の型です。
+    template<typename K, typename V>
+    class KeyValuePair
+    {
+    public:
+        /// キーの型です。
+        using KeyType = K;
+        /// 値の型です。
+        using ValueType = V;
+
+        /// キーです。
+        K key;
+        /// 値です。
+        V value;
+
+        /// 初期化します。
+        /// @param key キーです。
+        /// @param value 値です。
+        template<typename KK, typename VV>
+        KeyValuePair(KK &&key, VV &&value) noexcept
+            : key(Forward<KK>(key))
+            , value(Forward<VV>(value))
+        {}
+
+        /// キーのみ指定して初期化します。値は既定値です。
+        /// @param key キーです。
+        template<typename KK,
+                 typename = typename std::enable_if<!std::is_same<
+                     typename std::decay<KK>::type,
+                     KeyValuePair<K, V>>::value>::type>
+        explicit KeyValuePair(KK &&key) noexcept
+            : key(Forward<KK>(key))
+            , value()
+        {}
+
+        /// コピーします。
+        KeyValuePair(const KeyValuePair<K, V> &) = default;
+
+        /// ムーブします。
+        KeyValuePair(KeyValuePair<K, V> &&) = default;
+
+        /// コピー代入します。
+        KeyValuePair<K, V> &operator=(const KeyValuePair<K, V> &) = default;
+
+        /// ムーブ代入します。
+        KeyValuePair<K, V> &operator=(KeyValuePair<K, V> &&) = default;
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_KEYVALUEPAIR_HPP
\ No newline at end of file
@@ -0,0 +1,191 @@
+/// @file FuraiEngine/Collections/MpmcQueue.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 複数生産者複数消費者の有界ロックフリーキューを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_MPMCQUEUE_HPP
+#define _FURAIENGINE_COLLECTIONS_MPMCQUEUE_HPP
+#include <atomic>
+#include <new>
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Memory.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// MpmcQueueの要素を格納するセルです。
+        /// @tparam T 要素の型です。
+        template<typename T>
+        class MpmcQueueCell
+        {
+        public:
+            /// セルの状態を表す通し番号です。
+            std::atomic<USize> sequence;
+            /// 要素の格納領域です。
+            alignas(T) U8 storage[sizeof(T)];
+
+            /// 要素にアクセスします。
+            /// @return 要素のポインタです。
+            T *Element() noexcept
+            {
+                return (T *) this->storage;
+            }
+        };
+    }
+    /// @endcond
+
+    /// 複数生産者複数消費者の有界ロックフリーキューです。(Vyukov方式)
+    /// 追加、取り出しはブロックせず、メモリ確保も行いません。
+    /// @tparam T 要素の型です。
+    /// @tparam A アロケータの型です。要素型は_Internal::MpmcQueueCell<T>です。
+    template<typename T, typename A = Allocator<_Internal::MpmcQueueCell<T>>>
+    class MpmcQueue
+    {
+        using CellType = _Internal::MpmcQueueCell<T>;
+
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// アロケータの型です。
+        using AllocatorType = A;
+
+    private:
+        alignas(CACHE_LINE_SIZE) std::atomic<USize> m_enqueuePosition; // 次に追加する位置です。
+        alignas(CACHE_LINE_SIZE) std::atomic<USize> m_dequeuePosition; // 次に取り出す位置です。
+        alignas(CACHE_LINE_SIZE) USize m_capacity; // 容量です。(2の累乗)
+        USize         m_mask;                      // 位置を容量内に収めるマスクです。
+        AllocatorType m_allocator;
+        CellType     *m_pCells;
+
+    public:
+        /// 容量を指定して初期化します。
+        /// @param capacity 容量です。2の累乗に切り上げます。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        MpmcQueue(USize                capacity,
+                  const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_enqueuePosition(0)
+            , m_dequeuePosition(0)
+            , m_capacity((USize) NextPowerOfTwo(capacity < 2 ? 2 : capacity))
+            , m_mask(m_capacity - 1)
+            , m_allocator(allocator)
+            , m_pCells(nullptr)
+        {
+            if (!this->m_allocator
+                     .Allocate(this->m_capacity)
+                     .IsSuccess(this->m_pCells))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'MpmcQueue<{}>::MpmcQueue(USize capacity, "
+                             "const {} &allocator) noexcept'"),
+                         TypenameOf<T>(),
+                         TypenameOf<AllocatorType>());
+
+                ExitError();
+            }
+            for (USize i = 0; i < this->m_capacity; i++)
+                new (&this->m_pCells[i].sequence) std::atomic<USize>(i);
+        }
+
+        MpmcQueue(const MpmcQueue<T, A> &)                = delete;
+        MpmcQueue<T, A> &operator=(const MpmcQueue<T, A> &) = delete;
+
+        /// 解体します。
+        /// @warning 他のスレッドが使用していない状態で解体してください。
+        ~MpmcQueue() noexcept
+        {
+            auto head = this->m_dequeuePosition.load(std::memory_order_relaxed);
+            auto tail = this->m_enqueuePosition.load(std::memory_order_relaxed);
+            for (; head != tail; head++)
+                this->m_pCells[head & this->m_mask].Element()->~T();
+            static_cast<void>(
+                this->m_allocator.Deallocate(this->m_pCells, this->m_capacity));
+        }
+
+        /// 容量を取得します。
+        /// @return 容量です。
+        USize Capacity() const noexcept
+        {
+            return this->m_capacity;
+        }
+
+        /// 要素を追加します。
+        /// @param value 追加する要素です。
+        /// @return 追加した場合、真です。満杯の場合、偽です。
+        template<typename TT>
+        Bool TryPush(TT &&value) noexcept
+        {
+            auto      position = this->m_enqueuePosition.load(
+                std::memory_order_relaxed);
+            CellType *pCell    = nullptr;
+            while (true)
+            {
+                pCell         = &this->m_pCells[position & this->m_mask];
+                auto sequence = pCell->sequence.load(std::memory_order_acquire);
+                auto diff     = (ISize) sequence - (ISize) position;
+                if (diff == 0)
+                {
+                    if (this->m_enqueuePosition.compare_exchange_weak(
+                            position,
+                            position + 1,
+                            std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // 満杯です。
+                }
+                else
+                {
+                    position = this->m_enqueuePosition.load(
+                        std::memory_order_relaxed);
+                }
+            }
+            new (pCell->Element()) T(Forward<TT>(value));
+            pCell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// 要素を取り出します。
+        /// @param value 取り出した要素を受け取る参照です。
+        /// @return 取り出した場合、真です。空の場合、偽です。
+        Bool TryPop(T &value) noexcept
+        {
+            auto      position = this->m_dequeuePosition.load(
+                std::memory_order_relaxed);
+            CellType *pCell    = nullptr;
+            while (true)
+            {
+                pCell         = &this->m_pCells[position & this->m_mask];
+                auto sequence = pCell->sequence.load(std::memory_order_acquire);
+                auto diff     = (ISize) sequence - (ISize) (position + 1);
+                if (diff == 0)
+                {
+                    if (this->m_dequeuePosition.compare_exchange_weak(
+                            position,
+                            position + 1,
+                            std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // 空です。
+                }
+                else
+                {
+                    position = this->m_dequeuePosition.load(
+                        std::memory_order_relaxed);
+                }
+            }
+            auto pElement = pCell->Element();
+            value         = Move(*pElement);
+            pElement->~T();
+            pCell->sequence.store(position + this->m_mask + 1,
+                                  std::memory_order_release);
+            return true;
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_MPMCQUEUE_HPP
\ No newline at end of file
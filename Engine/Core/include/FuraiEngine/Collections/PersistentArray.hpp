@@ -0,0 +1,628 @@
+/// @file FuraiEngine/Collections/PersistentArray.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 構造を共有し、O(1)で複製できる配列を提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_PERSISTENTARRAY_HPP
+#define _FURAIENGINE_COLLECTIONS_PERSISTENTARRAY_HPP
+#include <atomic>
+#include <new>
+#include "FuraiEngine/Memory.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 永続配列の1階層あたりの添え字のビット数です。
+        constexpr U32 PERSISTENT_ARRAY_BITS = 5;
+        /// 永続配列のノードの分岐数です。
+        constexpr USize PERSISTENT_ARRAY_WIDTH = 1 << PERSISTENT_ARRAY_BITS;
+        /// 永続配列のノード内の添え字を取り出すマスクです。
+        constexpr USize PERSISTENT_ARRAY_MASK = PERSISTENT_ARRAY_WIDTH - 1;
+
+        /// 永続配列のノードです。複数の配列から共有され、参照数で解放します。
+        class PersistentArrayNode
+        {
+        public:
+            /// 参照数です。
+            std::atomic<U32> references;
+        };
+
+        /// 永続配列の要素を保持する葉ノードです。
+        /// @tparam T 要素の型です。
+        template<typename T>
+        class PersistentArrayLeaf : public PersistentArrayNode
+        {
+        public:
+            /// 要素数です。
+            USize count;
+            /// 要素の領域です。
+            alignas(T) U8 storage[sizeof(T) * PERSISTENT_ARRAY_WIDTH];
+
+            /// 要素の先頭を取得します。
+            /// @return 要素の先頭です。
+            T *Elements() noexcept
+            {
+                return (T *) this->storage;
+            }
+
+            /// 要素の先頭を取得します。
+            /// @return 要素の先頭です。
+            const T *Elements() const noexcept
+            {
+                return (const T *) this->storage;
+            }
+        };
+
+        /// 永続配列の子ノードを保持する枝ノードです。
+        class PersistentArrayBranch : public PersistentArrayNode
+        {
+        public:
+            /// 子ノードです。未使用の場合、nullptrです。
+            PersistentArrayNode *pChildren[PERSISTENT_ARRAY_WIDTH];
+        };
+    }
+    /// @endcond
+
+    template<typename T>
+    class PersistentArray;
+
+    /// 永続配列の読み取り専用イテレータです。
+    /// 要素の葉ノードを保持し、ノードをまたぐ時だけ木を辿ります。
+    /// @tparam T 要素の型です。
+    template<typename T>
+    class PersistentArrayIterator
+    {
+        const PersistentArray<T> *m_pArray;    // 走査する配列です。
+        USize                     m_index;     // 現在の位置です。
+        const T                  *m_pElements; // 現在の位置を含む葉ノードの要素です。
+
+    public:
+        /// 初期化します。
+        /// @param pArray 走査する配列です。
+        /// @param index 開始位置です。
+        PersistentArrayIterator(const PersistentArray<T> *pArray,
+                                USize                     index) noexcept
+            : m_pArray(pArray)
+            , m_index(index)
+            , m_pElements(index < pArray->Count() ? pArray->_ElementsOf(index)
+                                                  : nullptr)
+        {
+        }
+
+        /// 次の要素へ進めます。
+        /// @return 自身です。
+        PersistentArrayIterator<T> &operator++() noexcept
+        {
+            this->m_index += 1;
+            if ((this->m_index & _Internal::PERSISTENT_ARRAY_MASK) == 0
+                && this->m_index < this->m_pArray->Count())
+                this->m_pElements = this->m_pArray->_ElementsOf(this->m_index);
+            return *this;
+        }
+
+        /// 要素を取得します。
+        /// @return 要素です。
+        const T &operator*() const noexcept
+        {
+            return this->m_pElements[this->m_index
+                                     & _Internal::PERSISTENT_ARRAY_MASK];
+        }
+
+        /// 要素のメンバにアクセスします。
+        /// @return 要素のポインタです。
+        const T *operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        /// 同等か比較します。
+        /// @param other 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator==(const PersistentArrayIterator<T> &other) const noexcept
+        {
+            return this->m_index == other.m_index;
+        }
+
+        /// 不等か比較します。
+        /// @param other 比較対象です。
+        /// @return 不等の場合、真です。
+        Bool operator!=(const PersistentArrayIterator<T> &other) const noexcept
+        {
+            return this->m_index != other.m_index;
+        }
+    };
+
+    /// 構造を共有する永続配列です。
+    /// 32分木の葉に要素を保持し、末尾の葉は木の外に置いて追加を高速にします。
+    /// 複製はノードの参照数を増やすだけのO(1)で、変更時は共有されているノードだけを経路に沿って複製します。
+    /// ゲーム状態のスナップショットを毎フレーム取るような用途を想定しています。
+    /// @tparam T 要素の型です。コピー可能である必要があります。
+    /// @warning 1つのインスタンスはスレッド安全ではありません。構造を共有する別々のインスタンスは、別々のスレッドから操作できます。
+    template<typename T>
+    class PersistentArray
+    {
+        friend class PersistentArrayIterator<T>;
+
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// イテレータの型です。
+        using ConstIteratorType = PersistentArrayIterator<T>;
+
+    private:
+        using NodeType   = _Internal::PersistentArrayNode;
+        using LeafType   = _Internal::PersistentArrayLeaf<T>;
+        using BranchType = _Internal::PersistentArrayBranch;
+
+        NodeType *m_pRoot;  // 木の根です。要素が末尾の葉に収まる場合、nullptrです。
+        LeafType *m_pTail;  // 末尾の葉です。空の場合、nullptrです。
+        USize     m_count;  // 要素数です。
+        U32       m_shift;  // 根の階層の添え字のビット位置です。
+
+        /// メモリ確保の失敗を出力し、異常終了します。
+        [[noreturn]] static void _ExitBadAllocated() noexcept
+        {
+            LogError(TXT("メモリの確保に失敗しました。"
+                         "'PersistentArray<{}>'"),
+                     TypenameOf<T>());
+
+            ExitError();
+        }
+
+        /// 空の葉ノードを作成します。
+        /// @return 参照数1の葉ノードです。
+        static LeafType *_CreateLeaf() noexcept
+        {
+            LeafType *pLeaf = nullptr;
+            if (!Allocator<LeafType>().Allocate(1).IsSuccess(pLeaf))
+                _ExitBadAllocated();
+            new (&pLeaf->references) std::atomic<U32>(1);
+            pLeaf->count = 0;
+            return pLeaf;
+        }
+
+        /// 空の枝ノードを作成します。
+        /// @return 参照数1の枝ノードです。
+        static BranchType *_CreateBranch() noexcept
+        {
+            BranchType *pBranch = nullptr;
+            if (!Allocator<BranchType>().Allocate(1).IsSuccess(pBranch))
+                _ExitBadAllocated();
+            new (&pBranch->references) std::atomic<U32>(1);
+            for (USize i = 0; i < _Internal::PERSISTENT_ARRAY_WIDTH; i++)
+                pBranch->pChildren[i] = nullptr;
+            return pBranch;
+        }
+
+        /// ノードの参照を追加します。
+        /// @param pNode ノードです。nullptrの場合、何もしません。
+        static void _Retain(NodeType *pNode) noexcept
+        {
+            if (pNode != nullptr)
+                pNode->references.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// ノードの参照を解除し、最後の参照であれば子孫ごと解放します。
+        /// @param pNode ノードです。nullptrの場合、何もしません。
+        /// @param shift ノードの階層の添え字のビット位置です。葉ノードの場合、0です。
+        static void _Release(NodeType *pNode, U32 shift) noexcept
+        {
+            if (pNode == nullptr
+                || pNode->references.fetch_sub(1, std::memory_order_acq_rel)
+                       != 1)
+                return;
+            if (shift == 0)
+            {
+                auto pLeaf = (LeafType *) pNode;
+                for (USize i = 0; i < pLeaf->count; i++)
+                    pLeaf->Elements()[i].~T();
+                static_cast<void>(Allocator<LeafType>().Deallocate(pLeaf, 1));
+            }
+            else
+            {
+                auto pBranch = (BranchType *) pNode;
+                for (USize i = 0; i < _Internal::PERSISTENT_ARRAY_WIDTH; i++)
+                    _Release(pBranch->pChildren[i],
+                             shift - _Internal::PERSISTENT_ARRAY_BITS);
+                static_cast<void>(
+                    Allocator<BranchType>().Deallocate(pBranch, 1));
+            }
+        }
+
+        /// 葉ノードを他の配列と共有していない状態にします。共有されている場合は複製します。
+        /// @param pLeaf 葉ノードです。複製した場合、複製に置き換えます。
+        static void _MakeUniqueLeaf(LeafType *&pLeaf) noexcept
+        {
+            if (pLeaf->references.load(std::memory_order_acquire) == 1)
+                return;
+            auto pCopy = _CreateLeaf();
+            for (USize i = 0; i < pLeaf->count; i++)
+                new (&pCopy->Elements()[i]) T(pLeaf->Elements()[i]);
+            pCopy->count = pLeaf->count;
+            _Release(pLeaf, 0);
+            pLeaf = pCopy;
+        }
+
+        /// 枝ノードを他の配列と共有していない状態にします。共有されている場合は複製します。
+        /// @param pNode 枝ノードです。複製した場合、複製に置き換えます。
+        /// @param shift ノードの階層の添え字のビット位置です。
+        static void _MakeUniqueBranch(NodeType *&pNode, U32 shift) noexcept
+        {
+            if (pNode->references.load(std::memory_order_acquire) == 1)
+                return;
+            auto pBranch = (BranchType *) pNode;
+            auto pCopy   = _CreateBranch();
+            for (USize i = 0; i < _Internal::PERSISTENT_ARRAY_WIDTH; i++)
+            {
+                pCopy->pChildren[i] = pBranch->pChildren[i];
+                _Retain(pCopy->pChildren[i]);
+            }
+            _Release(pNode, shift);
+            pNode = pCopy;
+        }
+
+        /// 葉ノードだけを末端に持つ経路を作成します。
+        /// @param shift 経路の先頭の階層の添え字のビット位置です。
+        /// @param pLeaf 末端の葉ノードです。
+        /// @return 経路の先頭のノードです。
+        static NodeType *_CreatePath(U32 shift, LeafType *pLeaf) noexcept
+        {
+            if (shift == 0)
+                return pLeaf;
+            auto pBranch          = _CreateBranch();
+            pBranch->pChildren[0] =
+                _CreatePath(shift - _Internal::PERSISTENT_ARRAY_BITS, pLeaf);
+            return pBranch;
+        }
+
+        /// 木の外の要素の先頭の位置を取得します。
+        /// @return 末尾の葉ノードの先頭の位置です。
+        USize _TailOffset() const noexcept
+        {
+            if (this->m_count == 0)
+                return 0;
+            return (this->m_count - 1) & ~_Internal::PERSISTENT_ARRAY_MASK;
+        }
+
+        /// 木を辿って位置を含む葉ノードを取得します。
+        /// @param index 木の中の位置です。
+        /// @return 葉ノードです。
+        LeafType *_TreeLeafOf(USize index) const noexcept
+        {
+            auto pNode = this->m_pRoot;
+            for (auto shift = this->m_shift; shift > 0;
+                 shift -= _Internal::PERSISTENT_ARRAY_BITS)
+                pNode = ((BranchType *) pNode)
+                            ->pChildren[(index >> shift)
+                                        & _Internal::PERSISTENT_ARRAY_MASK];
+            return (LeafType *) pNode;
+        }
+
+        /// 位置を含む葉ノードを取得します。
+        /// @param index 位置です。
+        /// @return 葉ノードです。
+        LeafType *_LeafOf(USize index) const noexcept
+        {
+            if (index >= this->_TailOffset())
+                return this->m_pTail;
+            return this->_TreeLeafOf(index);
+        }
+
+        /// 位置を含む葉ノードの要素を取得します。
+        /// @param index 位置です。
+        /// @return 葉ノードの要素の先頭です。
+        const T *_ElementsOf(USize index) const noexcept
+        {
+            return this->_LeafOf(index)->Elements();
+        }
+
+        /// 満杯の末尾の葉ノードを木に移します。
+        void _PushTail() noexcept
+        {
+            auto index = this->m_count - _Internal::PERSISTENT_ARRAY_WIDTH;
+            if (this->m_pRoot == nullptr)
+            {
+                auto pRoot          = _CreateBranch();
+                pRoot->pChildren[0] = this->m_pTail;
+                this->m_pRoot       = pRoot;
+                this->m_shift       = _Internal::PERSISTENT_ARRAY_BITS;
+            }
+            else if ((index >> this->m_shift) >= _Internal::PERSISTENT_ARRAY_WIDTH)
+            {
+                // 根が満杯の場合、1階層深くします。
+                auto pRoot          = _CreateBranch();
+                pRoot->pChildren[0] = this->m_pRoot;
+                pRoot->pChildren[1] = _CreatePath(this->m_shift, this->m_pTail);
+                this->m_pRoot       = pRoot;
+                this->m_shift += _Internal::PERSISTENT_ARRAY_BITS;
+            }
+            else
+            {
+                auto ppNode = &this->m_pRoot;
+                for (auto shift = this->m_shift;;
+                     shift -= _Internal::PERSISTENT_ARRAY_BITS)
+                {
+                    _MakeUniqueBranch(*ppNode, shift);
+                    auto &pChild =
+                        ((BranchType *) *ppNode)
+                            ->pChildren[(index >> shift)
+                                        & _Internal::PERSISTENT_ARRAY_MASK];
+                    if (pChild == nullptr)
+                    {
+                        pChild = _CreatePath(
+                            shift - _Internal::PERSISTENT_ARRAY_BITS,
+                            this->m_pTail);
+                        break;
+                    }
+                    ppNode = &pChild;
+                }
+            }
+            this->m_pTail = nullptr;
+        }
+
+        /// 木の最後の葉ノードを取り除きます。
+        /// @param pNode 枝ノードです。
+        /// @param shift ノードの階層の添え字のビット位置です。
+        /// @param index 取り除く葉ノードの先頭の位置です。
+        /// @return ノードが空になった場合、真です。
+        static Bool _PopLeaf(NodeType *&pNode, U32 shift, USize index) noexcept
+        {
+            _MakeUniqueBranch(pNode, shift);
+            auto  slot   = (index >> shift) & _Internal::PERSISTENT_ARRAY_MASK;
+            auto &pChild = ((BranchType *) pNode)->pChildren[slot];
+            auto  childShift = shift - _Internal::PERSISTENT_ARRAY_BITS;
+            if (childShift != 0 && !_PopLeaf(pChild, childShift, index))
+                return false;
+            _Release(pChild, childShift);
+            pChild = nullptr;
+            return slot == 0;
+        }
+
+    public:
+        /// 空の配列で初期化します。
+        PersistentArray() noexcept
+            : m_pRoot(nullptr)
+            , m_pTail(nullptr)
+            , m_count(0)
+            , m_shift(_Internal::PERSISTENT_ARRAY_BITS)
+        {
+        }
+
+        /// 構造を共有して複製します。O(1)です。
+        /// @param origin 複製元です。
+        PersistentArray(const PersistentArray<T> &origin) noexcept
+            : m_pRoot(origin.m_pRoot)
+            , m_pTail(origin.m_pTail)
+            , m_count(origin.m_count)
+            , m_shift(origin.m_shift)
+        {
+            _Retain(this->m_pRoot);
+            _Retain(this->m_pTail);
+        }
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        PersistentArray(PersistentArray<T> &&origin) noexcept
+            : m_pRoot(origin.m_pRoot)
+            , m_pTail(origin.m_pTail)
+            , m_count(origin.m_count)
+            , m_shift(origin.m_shift)
+        {
+            origin.m_pRoot = nullptr;
+            origin.m_pTail = nullptr;
+            origin.m_count = 0;
+            origin.m_shift = _Internal::PERSISTENT_ARRAY_BITS;
+        }
+
+        /// 解体します。共有されていないノードを解放します。
+        ~PersistentArray() noexcept
+        {
+            _Release(this->m_pRoot, this->m_shift);
+            _Release(this->m_pTail, 0);
+        }
+
+        /// 構造を共有してコピー代入します。O(1)です。
+        /// @param origin 複製元です。
+        /// @return 自身です。
+        PersistentArray<T> &operator=(const PersistentArray<T> &origin) noexcept
+        {
+            if (this != &origin)
+            {
+                _Retain(origin.m_pRoot);
+                _Retain(origin.m_pTail);
+                _Release(this->m_pRoot, this->m_shift);
+                _Release(this->m_pTail, 0);
+                this->m_pRoot = origin.m_pRoot;
+                this->m_pTail = origin.m_pTail;
+                this->m_count = origin.m_count;
+                this->m_shift = origin.m_shift;
+            }
+            return *this;
+        }
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身です。
+        PersistentArray<T> &operator=(PersistentArray<T> &&origin) noexcept
+        {
+            if (this != &origin)
+            {
+                _Release(this->m_pRoot, this->m_shift);
+                _Release(this->m_pTail, 0);
+                this->m_pRoot  = origin.m_pRoot;
+                this->m_pTail  = origin.m_pTail;
+                this->m_count  = origin.m_count;
+                this->m_shift  = origin.m_shift;
+                origin.m_pRoot = nullptr;
+                origin.m_pTail = nullptr;
+                origin.m_count = 0;
+                origin.m_shift = _Internal::PERSISTENT_ARRAY_BITS;
+            }
+            return *this;
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 要素を取得します。O(log32 N)です。
+        /// @param index 位置です。
+        /// @return 要素です。
+        const ElementType &operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("const T &PersistentArray<T>::operator[](USize index) "
+                    "const noexcept"));
+            return this->_ElementsOf(index)[index & _Internal::PERSISTENT_ARRAY_MASK];
+        }
+
+        /// 要素を置き換えます。
+        /// 他の配列と共有しているノードは、根から要素までの経路だけを複製します。
+        /// @param index 位置です。
+        /// @param value 新しい値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename TT>
+        void Set(USize index, TT &&value) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("void PersistentArray<T>::Set(USize index, TT &&value) "
+                    "noexcept"));
+            if (index >= this->_TailOffset())
+            {
+                _MakeUniqueLeaf(this->m_pTail);
+                this->m_pTail->Elements()[index & _Internal::PERSISTENT_ARRAY_MASK] =
+                    Forward<TT>(value);
+                return;
+            }
+            auto ppNode = &this->m_pRoot;
+            for (auto shift = this->m_shift; shift > 0;
+                 shift -= _Internal::PERSISTENT_ARRAY_BITS)
+            {
+                _MakeUniqueBranch(*ppNode, shift);
+                ppNode = &((BranchType *) *ppNode)
+                              ->pChildren[(index >> shift)
+                                          & _Internal::PERSISTENT_ARRAY_MASK];
+            }
+            auto pLeaf = (LeafType *) *ppNode;
+            _MakeUniqueLeaf(pLeaf);
+            *ppNode = pLeaf;
+            pLeaf->Elements()[index & _Internal::PERSISTENT_ARRAY_MASK] =
+                Forward<TT>(value);
+        }
+
+        /// 末尾に要素を追加します。償却O(1)です。
+        /// @param value 追加する値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename TT>
+        void Add(TT &&value) noexcept
+        {
+            if (this->m_pTail == nullptr)
+            {
+                this->m_pTail = _CreateLeaf();
+            }
+            else if (this->m_pTail->count == _Internal::PERSISTENT_ARRAY_WIDTH)
+            {
+                this->_PushTail();
+                this->m_pTail = _CreateLeaf();
+            }
+            else
+            {
+                _MakeUniqueLeaf(this->m_pTail);
+            }
+            new (&this->m_pTail->Elements()[this->m_pTail->count])
+                T(Forward<TT>(value));
+            this->m_pTail->count += 1;
+            this->m_count += 1;
+        }
+
+        /// 末尾の要素を削除します。
+        void RemoveLast() noexcept
+        {
+            _Internal::CheckIndex(
+                0,
+                this->m_count,
+                TXT("void PersistentArray<T>::RemoveLast() noexcept"));
+            if (this->m_pTail->count > 1 || this->m_pRoot == nullptr)
+            {
+                _MakeUniqueLeaf(this->m_pTail);
+                this->m_pTail->count -= 1;
+                this->m_pTail->Elements()[this->m_pTail->count].~T();
+                this->m_count -= 1;
+                if (this->m_count == 0)
+                {
+                    _Release(this->m_pTail, 0);
+                    this->m_pTail = nullptr;
+                }
+                return;
+            }
+
+            // 末尾の葉が空になる為、木の最後の葉を末尾の葉にします。
+            _Release(this->m_pTail, 0);
+            this->m_count -= 1;
+            auto index    = this->m_count - _Internal::PERSISTENT_ARRAY_WIDTH;
+            this->m_pTail = this->_TreeLeafOf(index);
+            _Retain(this->m_pTail);
+            if (index == 0)
+            {
+                _Release(this->m_pRoot, this->m_shift);
+                this->m_pRoot = nullptr;
+                this->m_shift = _Internal::PERSISTENT_ARRAY_BITS;
+                return;
+            }
+            _PopLeaf(this->m_pRoot, this->m_shift, index);
+
+            // 根の子が1つだけになった場合、1階層浅くします。
+            while (this->m_shift > _Internal::PERSISTENT_ARRAY_BITS
+                   && ((BranchType *) this->m_pRoot)->pChildren[1] == nullptr)
+            {
+                auto pChild = ((BranchType *) this->m_pRoot)->pChildren[0];
+                _Retain(pChild);
+                _Release(this->m_pRoot, this->m_shift);
+                this->m_pRoot = pChild;
+                this->m_shift -= _Internal::PERSISTENT_ARRAY_BITS;
+            }
+        }
+
+        /// 全要素を削除します。
+        void Clear() noexcept
+        {
+            _Release(this->m_pRoot, this->m_shift);
+            _Release(this->m_pTail, 0);
+            this->m_pRoot = nullptr;
+            this->m_pTail = nullptr;
+            this->m_count = 0;
+            this->m_shift = _Internal::PERSISTENT_ARRAY_BITS;
+        }
+
+        /// 先頭のイテレータを取得します。
+        /// @return 先頭のイテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return ConstIteratorType(this, 0);
+        }
+
+        /// 終端のイテレータを取得します。
+        /// @return 終端のイテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return ConstIteratorType(this, this->m_count);
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_PERSISTENTARRAY_HPP
\ No newline at end of file
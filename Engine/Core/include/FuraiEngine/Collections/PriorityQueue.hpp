@@ -0,0 +1,517 @@
+/// @file FuraiEngine/Collections/PriorityQueue.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 4分ヒープによる優先度付きキューを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_PRIORITYQUEUE_HPP
+#define _FURAIENGINE_COLLECTIONS_PRIORITYQUEUE_HPP
+#include "FuraiEngine/Collections/Array.hpp"
+#include "FuraiEngine/Compare.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// ヒープの分岐数です。
+        /// 子が連続した領域に並ぶため、2分ヒープよりキャッシュ効率が良く、木も浅くなります。
+        constexpr USize HEAP_ARITY = 4;
+
+        /// 親の位置を計算します。
+        /// @param index 子の位置です。
+        /// @return 親の位置です。
+        constexpr USize HeapParentOf(USize index) noexcept
+        {
+            return (index - 1) / HEAP_ARITY;
+        }
+
+        /// 最初の子の位置を計算します。
+        /// @param index 親の位置です。
+        /// @return 最初の子の位置です。
+        constexpr USize HeapFirstChildOf(USize index) noexcept
+        {
+            return index * HEAP_ARITY + 1;
+        }
+
+        /// 子の中で最も優先度の高い位置を検索します。
+        /// @param pHeap ヒープの先頭です。
+        /// @param count ヒープの要素数です。
+        /// @param first 最初の子の位置です。
+        /// @param compare 優先度の比較関数です。
+        /// @param project 要素から比較値を取り出す関数です。
+        /// @return 最も優先度の高い子の位置です。
+        template<typename T, typename C, typename P>
+        USize HeapBestChildOf(const T  *pHeap,
+                              USize     count,
+                              USize     first,
+                              const C  &compare,
+                              const P  &project) noexcept
+        {
+            auto best = first;
+            auto last = first + HEAP_ARITY < count ? first + HEAP_ARITY : count;
+            for (auto i = first + 1; i < last; i++)
+            {
+                if (compare(project(pHeap[i]), project(pHeap[best])))
+                    best = i;
+            }
+            return best;
+        }
+
+        /// 添え字付き優先度付きキューの要素です。
+        /// @tparam T 優先度の型です。
+        template<typename T>
+        class IndexedHeapEntry
+        {
+        public:
+            /// 優先度です。
+            T priority;
+            /// キーです。
+            U32 key;
+
+            /// 初期化します。
+            /// @param priority 優先度です。
+            /// @param key キーです。
+            template<typename TT>
+            IndexedHeapEntry(TT &&priority, U32 key) noexcept
+                : priority(Forward<TT>(priority))
+                , key(key)
+            {
+            }
+        };
+    }
+    /// @endcond
+
+    /// 4分ヒープによる優先度付きキューです。
+    /// 比較関数が真を返す要素ほど先に取り出します。既定では最小の要素から取り出します。
+    /// @tparam T 要素の型です。
+    /// @tparam C 比較関数の型です。
+    /// @tparam A アロケータの型です。
+    template<typename T, typename C = Less<T>, typename A = Allocator<T>>
+    class PriorityQueue
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// 比較関数の型です。
+        using CompareType = C;
+        /// アロケータの型です。
+        using AllocatorType = A;
+
+    private:
+        Array<T, A> m_heap; // ヒープ順に並んだ要素です。
+        CompareType m_compare;
+
+        /// 要素をそのまま比較値とする関数です。
+        static const T &_Identity(const T &value) noexcept
+        {
+            return value;
+        }
+
+        /// 穴を根の方向へ移動させ、要素を配置します。
+        /// @param index 穴の位置です。
+        /// @param value 配置する要素です。
+        void _SiftUp(USize index, T &&value) noexcept
+        {
+            auto pHeap = this->m_heap.Data();
+            while (index > 0)
+            {
+                auto parent = _Internal::HeapParentOf(index);
+                if (!this->m_compare(value, pHeap[parent]))
+                    break;
+                pHeap[index] = Move(pHeap[parent]);
+                index        = parent;
+            }
+            pHeap[index] = Move(value);
+        }
+
+        /// 穴を葉の方向へ移動させ、要素を配置します。
+        /// @param index 穴の位置です。
+        /// @param value 配置する要素です。
+        void _SiftDown(USize index, T &&value) noexcept
+        {
+            auto pHeap = this->m_heap.Data();
+            auto count = this->m_heap.Count();
+            while (true)
+            {
+                auto first = _Internal::HeapFirstChildOf(index);
+                if (first >= count)
+                    break;
+                auto best = _Internal::HeapBestChildOf(pHeap,
+                                                       count,
+                                                       first,
+                                                       this->m_compare,
+                                                       _Identity);
+                if (!this->m_compare(pHeap[best], value))
+                    break;
+                pHeap[index] = Move(pHeap[best]);
+                index        = best;
+            }
+            pHeap[index] = Move(value);
+        }
+
+    public:
+        /// 初期化します。
+        /// @param compare 比較関数です。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        PriorityQueue(const CompareType   &compare   = CompareType(),
+                      const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_heap(allocator)
+            , m_compare(compare)
+        {
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_heap.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_heap.IsEmpty();
+        }
+
+        /// 最も優先度の高い要素を取得します。
+        /// @return 最も優先度の高い要素です。
+        /// @warning 空の場合は呼び出せません。
+        const ElementType &Top() const noexcept
+        {
+            return this->m_heap[0];
+        }
+
+        /// 容量を予約します。
+        /// @param count 予約する要素数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_heap.Reserve(count);
+        }
+
+        /// 要素を追加します。
+        /// @param value 追加する要素です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename TT>
+        void Push(TT &&value) noexcept
+        {
+            this->m_heap.Add(T(Forward<TT>(value)));
+            auto last = this->m_heap.Count() - 1;
+            T    element(Move(this->m_heap[last]));
+            this->_SiftUp(last, Move(element));
+        }
+
+        /// 最も優先度の高い要素を削除します。
+        /// @warning 空の場合は呼び出せません。
+        void Pop() noexcept
+        {
+            auto last = this->m_heap.Count() - 1;
+            if (last > 0)
+            {
+                T element(Move(this->m_heap[last]));
+                this->m_heap.RemoveLast();
+                this->_SiftDown(0, Move(element));
+            }
+            else
+            {
+                this->m_heap.RemoveLast();
+            }
+        }
+
+        /// 最も優先度の高い要素を取り出します。
+        /// @param value 取り出した要素を受け取る参照です。
+        /// @return 取り出した場合、真です。空の場合、偽です。
+        Bool TryPop(ElementType &value) noexcept
+        {
+            if (this->m_heap.IsEmpty())
+                return false;
+            value = Move(this->m_heap[0]);
+            this->Pop();
+            return true;
+        }
+
+        /// すべての要素を削除します。
+        void Clear() noexcept
+        {
+            this->m_heap.Clear();
+        }
+    };
+
+    /// 添え字付き優先度付きキューです。
+    /// U32のキーごとに優先度を持ち、優先度の変更(decrease-key)と任意キーの削除をO(log n)で行います。
+    /// キーは経路探索のノード番号のように、0から密に振られた値を想定しています。
+    /// 比較関数が真を返す優先度ほど先に取り出します。既定では最小の優先度から取り出します。
+    /// @tparam T 優先度の型です。
+    /// @tparam C 比較関数の型です。
+    /// @tparam A アロケータの型です。要素型は_Internal::IndexedHeapEntry<T>です。
+    template<typename T,
+             typename C = Less<T>,
+             typename A = Allocator<_Internal::IndexedHeapEntry<T>>>
+    class IndexedPriorityQueue
+    {
+        using EntryType = _Internal::IndexedHeapEntry<T>;
+
+        static constexpr U32 INVALID_POSITION = U32_MAX; // ヒープに存在しない位置です。
+
+    public:
+        /// 優先度の型です。
+        using PriorityType = T;
+        /// 比較関数の型です。
+        using CompareType = C;
+        /// アロケータの型です。
+        using AllocatorType = A;
+
+    private:
+        Array<EntryType, A> m_heap;      // ヒープ順に並んだ要素です。
+        Array<U32>          m_positions; // キーからヒープ上の位置への対応です。
+        CompareType         m_compare;
+
+        /// 要素から優先度を取り出します。
+        static const T &_PriorityOf(const EntryType &entry) noexcept
+        {
+            return entry.priority;
+        }
+
+        /// 要素を配置し、位置の対応を更新します。
+        /// @param index 配置する位置です。
+        /// @param entry 配置する要素です。
+        void _Place(USize index, EntryType &&entry) noexcept
+        {
+            this->m_positions[entry.key] = (U32) index;
+            this->m_heap[index]          = Move(entry);
+        }
+
+        /// 穴を根の方向へ移動させ、要素を配置します。
+        /// @param index 穴の位置です。
+        /// @param entry 配置する要素です。
+        void _SiftUp(USize index, EntryType &&entry) noexcept
+        {
+            auto pHeap = this->m_heap.Data();
+            while (index > 0)
+            {
+                auto parent = _Internal::HeapParentOf(index);
+                if (!this->m_compare(entry.priority, pHeap[parent].priority))
+                    break;
+                this->_Place(index, Move(pHeap[parent]));
+                index = parent;
+            }
+            this->_Place(index, Move(entry));
+        }
+
+        /// 穴を葉の方向へ移動させ、要素を配置します。
+        /// @param index 穴の位置です。
+        /// @param entry 配置する要素です。
+        void _SiftDown(USize index, EntryType &&entry) noexcept
+        {
+            auto pHeap = this->m_heap.Data();
+            auto count = this->m_heap.Count();
+            while (true)
+            {
+                auto first = _Internal::HeapFirstChildOf(index);
+                if (first >= count)
+                    break;
+                auto best = _Internal::HeapBestChildOf(pHeap,
+                                                       count,
+                                                       first,
+                                                       this->m_compare,
+                                                       _PriorityOf);
+                if (!this->m_compare(pHeap[best].priority, entry.priority))
+                    break;
+                this->_Place(index, Move(pHeap[best]));
+                index = best;
+            }
+            this->_Place(index, Move(entry));
+        }
+
+        /// 要素を適切な位置へ移動させます。
+        /// @param index 要素の位置です。
+        void _Fix(USize index) noexcept
+        {
+            EntryType entry(Move(this->m_heap[index]));
+            if (index > 0
+                && this->m_compare(
+                    entry.priority,
+                    this->m_heap[_Internal::HeapParentOf(index)].priority))
+                this->_SiftUp(index, Move(entry));
+            else
+                this->_SiftDown(index, Move(entry));
+        }
+
+        /// 指定位置の要素を削除します。
+        /// @param index 削除する位置です。
+        void _RemoveAt(USize index) noexcept
+        {
+            auto last = this->m_heap.Count() - 1;
+            this->m_positions[this->m_heap[index].key] = INVALID_POSITION;
+            if (index != last)
+            {
+                this->m_heap[index] = Move(this->m_heap[last]);
+                this->m_heap.RemoveLast();
+                this->_Fix(index);
+            }
+            else
+            {
+                this->m_heap.RemoveLast();
+            }
+        }
+
+    public:
+        /// 初期化します。
+        /// @param compare 比較関数です。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        IndexedPriorityQueue(
+            const CompareType   &compare   = CompareType(),
+            const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_heap(allocator)
+            , m_positions()
+            , m_compare(compare)
+        {
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_heap.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_heap.IsEmpty();
+        }
+
+        /// キーが含まれるか判定します。
+        /// @param key キーです。
+        /// @return 含まれる場合、真です。
+        Bool Contains(U32 key) const noexcept
+        {
+            return key < this->m_positions.Count()
+                && this->m_positions[key] != INVALID_POSITION;
+        }
+
+        /// キーの優先度を取得します。
+        /// @param key キーです。
+        /// @return 優先度です。
+        /// @warning 含まれないキーは指定できません。
+        const PriorityType &PriorityOf(U32 key) const noexcept
+        {
+            return this->m_heap[this->m_positions[key]].priority;
+        }
+
+        /// 最も優先度の高いキーを取得します。
+        /// @return キーです。
+        /// @warning 空の場合は呼び出せません。
+        U32 TopKey() const noexcept
+        {
+            return this->m_heap[0].key;
+        }
+
+        /// 最も高い優先度を取得します。
+        /// @return 優先度です。
+        /// @warning 空の場合は呼び出せません。
+        const PriorityType &TopPriority() const noexcept
+        {
+            return this->m_heap[0].priority;
+        }
+
+        /// キーの最大値を予約します。
+        /// @param count 予約するキーの数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize count) noexcept
+        {
+            this->m_heap.Reserve(count);
+            if (this->m_positions.Count() < count)
+                this->m_positions.Resize(count, INVALID_POSITION);
+        }
+
+        /// キーを追加します。
+        /// @param key キーです。
+        /// @param priority 優先度です。
+        /// @return 追加した場合、真です。既に含まれる場合、偽です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename TT>
+        Bool Push(U32 key, TT &&priority) noexcept
+        {
+            if (this->Contains(key))
+                return false;
+            if (this->m_positions.Count() <= key)
+                this->m_positions.Resize((USize) key + 1, INVALID_POSITION);
+            this->m_heap.Add(EntryType(Forward<TT>(priority), key));
+            auto      last = this->m_heap.Count() - 1;
+            EntryType entry(Move(this->m_heap[last]));
+            this->_SiftUp(last, Move(entry));
+            return true;
+        }
+
+        /// キーの優先度を変更します。
+        /// 優先度が上がる場合も下がる場合も扱えます。
+        /// @param key キーです。
+        /// @param priority 新しい優先度です。
+        /// @return 変更した場合、真です。含まれない場合、偽です。
+        template<typename TT>
+        Bool Update(U32 key, TT &&priority) noexcept
+        {
+            if (!this->Contains(key))
+                return false;
+            auto index                   = this->m_positions[key];
+            this->m_heap[index].priority = Forward<TT>(priority);
+            this->_Fix(index);
+            return true;
+        }
+
+        /// キーを追加、または、優先度を変更します。
+        /// @param key キーです。
+        /// @param priority 優先度です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename TT>
+        void Set(U32 key, TT &&priority) noexcept
+        {
+            if (!this->Update(key, priority))
+                this->Push(key, Forward<TT>(priority));
+        }
+
+        /// 最も優先度の高いキーを削除します。
+        /// @warning 空の場合は呼び出せません。
+        void Pop() noexcept
+        {
+            this->_RemoveAt(0);
+        }
+
+        /// 最も優先度の高いキーを取り出します。
+        /// @param key 取り出したキーを受け取る参照です。
+        /// @return 取り出した場合、真です。空の場合、偽です。
+        Bool TryPop(U32 &key) noexcept
+        {
+            if (this->m_heap.IsEmpty())
+                return false;
+            key = this->m_heap[0].key;
+            this->_RemoveAt(0);
+            return true;
+        }
+
+        /// キーを削除します。
+        /// @param key キーです。
+        /// @return 削除した場合、真です。含まれない場合、偽です。
+        Bool Remove(U32 key) noexcept
+        {
+            if (!this->Contains(key))
+                return false;
+            this->_RemoveAt(this->m_positions[key]);
+            return true;
+        }
+
+        /// すべてのキーを削除します。
+        void Clear() noexcept
+        {
+            for (USize i = 0; i < this->m_heap.Count(); i++)
+                this->m_positions[this->m_heap[i].key] = INVALID_POSITION;
+            this->m_heap.Clear();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_PRIORITYQUEUE_HPP
\ No newline at end of file
@@ -0,0 +1,596 @@
+/// @file FuraiEngine/Collections/Span.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 所有権を持たない連続領域の参照を提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_SPAN_HPP
+#define _FURAIENGINE_COLLECTIONS_SPAN_HPP
+#include <iterator>
+#include "FuraiEngine/Collections/Array.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 所有権を持たない可変の連続領域の参照です。
+    /// Array、生配列、メモリマップされた領域などを複製せずに受け渡す為に使用します。
+    /// @tparam T 要素の型です。
+    /// @warning 参照先より長く保持しないでください。
+    template<typename T>
+    class Span
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// イテレータの型です。
+        using IteratorType = PointerIterator<T>;
+
+    private:
+        T    *m_pData; // 先頭の要素です。
+        USize m_count; // 要素数です。
+
+    public:
+        /// 空の参照で初期化します。
+        Span() noexcept
+            : m_pData(nullptr)
+            , m_count(0)
+        {
+        }
+
+        /// 領域を指定して初期化します。
+        /// @param pData 先頭の要素です。
+        /// @param count 要素数です。
+        Span(T *pData, USize count) noexcept
+            : m_pData(pData)
+            , m_count(count)
+        {
+        }
+
+        /// 生配列を参照します。
+        /// @param array 参照する配列です。
+        template<USize N>
+        Span(T (&array)[N]) noexcept
+            : m_pData(array)
+            , m_count(N)
+        {
+        }
+
+        /// Arrayを参照します。
+        /// @param array 参照する配列です。要素の追加、削除で参照は無効になります。
+        template<typename A>
+        Span(Array<T, A> &array) noexcept
+            : m_pData(array.Data())
+            , m_count(array.Count())
+        {
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 先頭の要素のポインタを取得します。
+        /// @return 先頭の要素のポインタです。
+        ElementType *Data() const noexcept
+        {
+            return this->m_pData;
+        }
+
+        /// 要素にアクセスします。
+        /// @param index 位置です。
+        /// @return 要素の参照です。
+        ElementType &operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("T &Span<T>::operator[](USize index) const noexcept"));
+            return this->m_pData[index];
+        }
+
+        /// 部分領域を取得します。
+        /// @param offset 先頭の位置です。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        Span<T> Slice(USize offset, USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                offset,
+                count,
+                this->m_count,
+                TXT("Span<T> Span<T>::Slice(USize offset, USize count) const "
+                    "noexcept"));
+            return Span<T>(this->m_pData + offset, count);
+        }
+
+        /// 指定位置から末尾までの部分領域を取得します。
+        /// @param offset 先頭の位置です。
+        /// @return 部分領域の参照です。
+        Span<T> Slice(USize offset) const noexcept
+        {
+            _Internal::CheckRange(
+                offset,
+                0,
+                this->m_count,
+                TXT("Span<T> Span<T>::Slice(USize offset) const noexcept"));
+            return Span<T>(this->m_pData + offset, this->m_count - offset);
+        }
+
+        /// 先頭から指定数の部分領域を取得します。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        Span<T> First(USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                0,
+                count,
+                this->m_count,
+                TXT("Span<T> Span<T>::First(USize count) const noexcept"));
+            return Span<T>(this->m_pData, count);
+        }
+
+        /// 末尾から指定数の部分領域を取得します。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        Span<T> Last(USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                0,
+                count,
+                this->m_count,
+                TXT("Span<T> Span<T>::Last(USize count) const noexcept"));
+            return Span<T>(this->m_pData + this->m_count - count, count);
+        }
+
+        /// バイト列として参照します。
+        /// @return バイト列の参照です。
+        Span<U8> AsBytes() const noexcept
+        {
+            return Span<U8>((U8 *) this->m_pData, this->m_count * sizeof(T));
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() const noexcept
+        {
+            return IteratorType(this->m_pData,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() const noexcept
+        {
+            return IteratorType(this->m_pData + this->m_count,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+    };
+
+    /// 所有権を持たない不変の連続領域の参照です。
+    /// Array、生配列、メモリマップされた領域などを複製せずに受け渡す為に使用します。
+    /// @tparam T 要素の型です。
+    /// @warning 参照先より長く保持しないでください。
+    template<typename T>
+    class ConstSpan
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// イテレータの型です。
+        using IteratorType = ConstPointerIterator<T>;
+
+    private:
+        const T *m_pData; // 先頭の要素です。
+        USize    m_count; // 要素数です。
+
+    public:
+        /// 空の参照で初期化します。
+        ConstSpan() noexcept
+            : m_pData(nullptr)
+            , m_count(0)
+        {
+        }
+
+        /// 領域を指定して初期化します。
+        /// @param pData 先頭の要素です。
+        /// @param count 要素数です。
+        ConstSpan(const T *pData, USize count) noexcept
+            : m_pData(pData)
+            , m_count(count)
+        {
+        }
+
+        /// 生配列を参照します。
+        /// @param array 参照する配列です。
+        template<USize N>
+        ConstSpan(const T (&array)[N]) noexcept
+            : m_pData(array)
+            , m_count(N)
+        {
+        }
+
+        /// Arrayを参照します。
+        /// @param array 参照する配列です。要素の追加、削除で参照は無効になります。
+        template<typename A>
+        ConstSpan(const Array<T, A> &array) noexcept
+            : m_pData(array.Data())
+            , m_count(array.Count())
+        {
+        }
+
+        /// 可変の参照から変換します。
+        /// @param span 変換元です。
+        ConstSpan(const Span<T> &span) noexcept
+            : m_pData(span.Data())
+            , m_count(span.Count())
+        {
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 先頭の要素のポインタを取得します。
+        /// @return 先頭の要素のポインタです。
+        const ElementType *Data() const noexcept
+        {
+            return this->m_pData;
+        }
+
+        /// 要素にアクセスします。
+        /// @param index 位置です。
+        /// @return 要素の参照です。
+        const ElementType &operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("const T &ConstSpan<T>::operator[](USize index) const "
+                    "noexcept"));
+            return this->m_pData[index];
+        }
+
+        /// 部分領域を取得します。
+        /// @param offset 先頭の位置です。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        ConstSpan<T> Slice(USize offset, USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                offset,
+                count,
+                this->m_count,
+                TXT("ConstSpan<T> ConstSpan<T>::Slice(USize offset, USize count) const "
+                    "noexcept"));
+            return ConstSpan<T>(this->m_pData + offset, count);
+        }
+
+        /// 指定位置から末尾までの部分領域を取得します。
+        /// @param offset 先頭の位置です。
+        /// @return 部分領域の参照です。
+        ConstSpan<T> Slice(USize offset) const noexcept
+        {
+            _Internal::CheckRange(
+                offset,
+                0,
+                this->m_count,
+                TXT("ConstSpan<T> ConstSpan<T>::Slice(USize offset) const noexcept"));
+            return ConstSpan<T>(this->m_pData + offset, this->m_count - offset);
+        }
+
+        /// 先頭から指定数の部分領域を取得します。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        ConstSpan<T> First(USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                0,
+                count,
+                this->m_count,
+                TXT("ConstSpan<T> ConstSpan<T>::First(USize count) const noexcept"));
+            return ConstSpan<T>(this->m_pData, count);
+        }
+
+        /// 末尾から指定数の部分領域を取得します。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        ConstSpan<T> Last(USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                0,
+                count,
+                this->m_count,
+                TXT("ConstSpan<T> ConstSpan<T>::Last(USize count) const noexcept"));
+            return ConstSpan<T>(this->m_pData + this->m_count - count, count);
+        }
+
+        /// バイト列として参照します。
+        /// @return バイト列の参照です。
+        ConstSpan<U8> AsBytes() const noexcept
+        {
+            return ConstSpan<U8>((const U8 *) this->m_pData,
+                                 this->m_count * sizeof(T));
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() const noexcept
+        {
+            return IteratorType(this->m_pData,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() const noexcept
+        {
+            return IteratorType(this->m_pData + this->m_count,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+    };
+
+    /// 一定間隔で並ぶ要素のイテレータです。
+    /// @tparam T 要素の型です。不変の場合、const修飾します。
+    template<typename T>
+    class StridedIterator
+    {
+        U8   *m_pElement; // 現在位置の要素です。
+        USize m_stride;   // 要素の間隔です。(バイト)
+
+    public:
+        /// イテレータのカテゴリフラグ型です。
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /// 要素型の型エイリアスです。
+        using value_type = T;
+
+        /// イテレータの移動距離を表現する為の符号付き整数型の型エイリアスです。
+        using difference_type = ISize;
+
+        /// 要素型のポインタ型エイリアスです。
+        using pointer = T *;
+
+        /// 要素型の参照型エイリアスです。
+        using reference = T &;
+
+        /// 初期化します。
+        /// @param pElement 現在位置の要素です。
+        /// @param stride 要素の間隔です。(バイト)
+        StridedIterator(U8 *pElement, USize stride) noexcept
+            : m_pElement(pElement)
+            , m_stride(stride)
+        {
+        }
+
+        /// 指定分進めます。
+        /// @param step 進める数です。
+        StridedIterator<T> &operator+=(USize step) noexcept
+        {
+            this->m_pElement += step * this->m_stride;
+            return *this;
+        }
+
+        /// 指定分戻ります。
+        /// @param step 戻る数です。
+        StridedIterator<T> &operator-=(USize step) noexcept
+        {
+            this->m_pElement -= step * this->m_stride;
+            return *this;
+        }
+
+        /// 一つ進めます。
+        StridedIterator<T> &operator++() noexcept
+        {
+            this->m_pElement += this->m_stride;
+            return *this;
+        }
+
+        /// 一つ進めて、進む前のイテレータを返します。
+        /// @return 進める前のイテレータです。
+        StridedIterator<T> operator++(int) noexcept
+        {
+            auto iter = *this;
+            this->m_pElement += this->m_stride;
+            return iter;
+        }
+
+        /// 一つ戻ります。
+        StridedIterator<T> &operator--() noexcept
+        {
+            this->m_pElement -= this->m_stride;
+            return *this;
+        }
+
+        /// 一つ戻って、戻る前のイテレータを返します。
+        /// @return 戻る前のイテレータです。
+        StridedIterator<T> operator--(int) noexcept
+        {
+            auto iter = *this;
+            this->m_pElement -= this->m_stride;
+            return iter;
+        }
+
+        /// 要素にアクセスします。
+        /// @return 要素の参照です。
+        T &operator*() const noexcept
+        {
+            return *(T *) this->m_pElement;
+        }
+
+        /// 要素のメンバにアクセスします。
+        /// @return 要素のポインタです。
+        T *operator->() const noexcept
+        {
+            return (T *) this->m_pElement;
+        }
+
+        /// 要素が同等か比較します。
+        /// @param other 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator==(const StridedIterator<T> &other) const noexcept
+        {
+            return this->m_pElement == other.m_pElement;
+        }
+
+        /// 要素が不等か比較します。
+        /// @param other 比較対象です。
+        /// @return 不等の場合、真です。
+        Bool operator!=(const StridedIterator<T> &other) const noexcept
+        {
+            return this->m_pElement != other.m_pElement;
+        }
+    };
+
+    /// 所有権を持たない、一定間隔で並ぶ要素の参照です。
+    /// 構造体の配列から特定のメンバだけを列として扱う為に使用します。
+    /// @tparam T 要素の型です。不変の場合、const修飾します。
+    /// @warning 参照先より長く保持しないでください。
+    template<typename T>
+    class StridedSpan
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// イテレータの型です。
+        using IteratorType = StridedIterator<T>;
+
+    private:
+        U8   *m_pData;  // 先頭の要素です。
+        USize m_count;  // 要素数です。
+        USize m_stride; // 要素の間隔です。(バイト)
+
+    public:
+        /// 空の参照で初期化します。
+        StridedSpan() noexcept
+            : m_pData(nullptr)
+            , m_count(0)
+            , m_stride(sizeof(T))
+        {
+        }
+
+        /// 領域を指定して初期化します。
+        /// @param pFirst 先頭の要素です。
+        /// @param count 要素数です。
+        /// @param stride 要素の間隔です。(バイト)
+        StridedSpan(T *pFirst, USize count, USize stride) noexcept
+            : m_pData((U8 *) pFirst)
+            , m_count(count)
+            , m_stride(stride)
+        {
+        }
+
+        /// 連続領域の参照から変換します。
+        /// @param span 変換元です。
+        StridedSpan(const Span<T> &span) noexcept
+            : m_pData((U8 *) span.Data())
+            , m_count(span.Count())
+            , m_stride(sizeof(T))
+        {
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 要素の間隔を取得します。
+        /// @return 要素の間隔です。(バイト)
+        USize Stride() const noexcept
+        {
+            return this->m_stride;
+        }
+
+        /// 要素にアクセスします。
+        /// @param index 位置です。
+        /// @return 要素の参照です。
+        ElementType &operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("T &StridedSpan<T>::operator[](USize index) const noexcept"));
+            return *(T *) (this->m_pData + index * this->m_stride);
+        }
+
+        /// 部分領域を取得します。
+        /// @param offset 先頭の位置です。
+        /// @param count 要素数です。
+        /// @return 部分領域の参照です。
+        StridedSpan<T> Slice(USize offset, USize count) const noexcept
+        {
+            _Internal::CheckRange(
+                offset,
+                count,
+                this->m_count,
+                TXT("StridedSpan<T> StridedSpan<T>::Slice(USize offset, USize "
+                    "count) const noexcept"));
+            return StridedSpan<T>((T *) (this->m_pData + offset * this->m_stride),
+                                  count,
+                                  this->m_stride);
+        }
+
+        /// 指定数ごとに要素を間引いた参照を取得します。
+        /// @param step 間引く間隔です。1以上である必要があります。
+        /// @return 間引いた参照です。
+        /// @warning 間引く間隔が0の場合、異常終了します。
+        StridedSpan<T> Step(USize step) const noexcept
+        {
+            if (step == 0)
+            {
+                LogError(TXT("間引く間隔が0です。"
+                             "'StridedSpan<T> StridedSpan<T>::Step(USize step) "
+                             "const noexcept'"));
+
+                ExitError();
+            }
+            return StridedSpan<T>((T *) this->m_pData,
+                                  (this->m_count + step - 1) / step,
+                                  this->m_stride * step);
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() const noexcept
+        {
+            return IteratorType(this->m_pData, this->m_stride);
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() const noexcept
+        {
+            return IteratorType(this->m_pData + this->m_count * this->m_stride,
+                                this->m_stride);
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_SPAN_HPP
\ No newline at end of file
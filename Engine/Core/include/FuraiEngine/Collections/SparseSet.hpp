@@ -0,0 +1,398 @@
+/// @file FuraiEngine/Collections/SparseSet.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// スパースセットを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_SPARSESET_HPP
+#define _FURAIENGINE_COLLECTIONS_SPARSESET_HPP
+#include "FuraiEngine/Collections/Array.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// キーから密配列の位置を引くページ分割された疎配列です。
+        /// ページは使用されたキーの範囲だけ確保されます。
+        /// @tparam PAGE_SIZE 1ページの要素数です。(2の累乗)
+        template<USize PAGE_SIZE>
+        class SparseIndex
+        {
+            static_assert((PAGE_SIZE & (PAGE_SIZE - 1)) == 0,
+                          "PAGE_SIZE must be a power of two.");
+
+        public:
+            /// 未使用を表す位置です。
+            static constexpr U32 INVALID_INDEX = U32_MAX;
+
+        private:
+            Array<U32 *, Allocator<U32 *>> m_pages; // ページのリストです。
+            Allocator<U32>                 m_pageAllocator;
+
+        public:
+            /// 初期化します。
+            /// @warning メモリ確保に失敗した場合、異常終了します。
+            SparseIndex() noexcept
+                : m_pages()
+                , m_pageAllocator()
+            {}
+
+            /// ムーブします。
+            /// @param origin ムーブ元です。
+            SparseIndex(SparseIndex<PAGE_SIZE> &&origin) noexcept = default;
+
+            SparseIndex(const SparseIndex<PAGE_SIZE> &) = delete;
+            SparseIndex<PAGE_SIZE> &
+            operator=(const SparseIndex<PAGE_SIZE> &) = delete;
+
+            /// 解体します。
+            ~SparseIndex() noexcept
+            {
+                for (USize i = 0; i < this->m_pages.Count(); i++)
+                {
+                    if (this->m_pages[i] != nullptr)
+                        static_cast<void>(this->m_pageAllocator.Deallocate(
+                            this->m_pages[i], PAGE_SIZE));
+                }
+            }
+
+            /// キーに対応する位置を取得します。
+            /// @param key キーです。
+            /// @return 密配列の位置、または、INVALID_INDEXです。
+            U32 Get(U32 key) const noexcept
+            {
+                auto page = key / PAGE_SIZE;
+                if (page >= this->m_pages.Count()
+                    || this->m_pages[page] == nullptr)
+                    return INVALID_INDEX;
+                return this->m_pages[page][key & (PAGE_SIZE - 1)];
+            }
+
+            /// キーに対応する位置を設定します。必要ならページを確保します。
+            /// @param key キーです。
+            /// @param index 密配列の位置です。
+            /// @warning メモリ確保に失敗した場合、異常終了します。
+            void Set(U32 key, U32 index) noexcept
+            {
+                auto page = key / PAGE_SIZE;
+                while (this->m_pages.Count() <= page)
+                    this->m_pages.Add(nullptr);
+                if (this->m_pages[page] == nullptr)
+                {
+                    U32 *pPage = nullptr;
+                    if (!this->m_pageAllocator.Allocate(PAGE_SIZE).IsSuccess(
+                            pPage))
+                    {
+                        LogError(TXT("メモリの確保に失敗しました。"
+                                     "'SparseIndex::Set(U32 key, U32 index) "
+                                     "noexcept'"));
+
+                        ExitError();
+                    }
+                    for (USize i = 0; i < PAGE_SIZE; i++)
+                        pPage[i] = INVALID_INDEX;
+                    this->m_pages[page] = pPage;
+                }
+                this->m_pages[page][key & (PAGE_SIZE - 1)] = index;
+            }
+        };
+    }
+    /// @endcond
+
+    /// 整数キーの集合です。
+    /// 追加、削除、判定はO(1)で、キーは密配列で連続して走査できます。
+    /// @tparam PAGE_SIZE 疎配列の1ページの要素数です。(2の累乗)
+    /// @warning 削除で末尾のキーが削除位置に移動するため、キーの順序は保たれません。
+    template<USize PAGE_SIZE = 1024>
+    class SparseKeySet
+    {
+        using IndexType = _Internal::SparseIndex<PAGE_SIZE>;
+
+    public:
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename Array<U32>::ConstIteratorType;
+
+    private:
+        IndexType  m_sparse; // キーから密配列の位置を引く疎配列です。
+        Array<U32> m_keys;   // キーの密配列です。
+
+    public:
+        /// 初期化します。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        SparseKeySet() noexcept
+            : m_sparse()
+            , m_keys()
+        {}
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        SparseKeySet(SparseKeySet<PAGE_SIZE> &&origin) noexcept = default;
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_keys.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_keys.IsEmpty();
+        }
+
+        /// キーが存在するか判定します。
+        /// @param key キーです。
+        /// @return 存在する場合、真です。
+        Bool Contains(U32 key) const noexcept
+        {
+            return this->m_sparse.Get(key) != IndexType::INVALID_INDEX;
+        }
+
+        /// キーを追加します。
+        /// @param key キーです。
+        /// @return 追加した場合、真です。既に存在した場合、偽です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        Bool Add(U32 key) noexcept
+        {
+            if (this->Contains(key))
+                return false;
+            this->m_sparse.Set(key, (U32) this->m_keys.Count());
+            this->m_keys.Add(key);
+            return true;
+        }
+
+        /// キーを削除します。
+        /// @param key キーです。
+        /// @return 削除した場合、真です。
+        Bool Remove(U32 key) noexcept
+        {
+            auto index = this->m_sparse.Get(key);
+            if (index == IndexType::INVALID_INDEX)
+                return false;
+            auto lastKey = this->m_keys[this->m_keys.Count() - 1];
+            this->m_sparse.Set(lastKey, index);
+            this->m_sparse.Set(key, IndexType::INVALID_INDEX);
+            this->m_keys.RemoveAtSwapLast(index);
+            return true;
+        }
+
+        /// 全てのキーを削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            for (USize i = 0; i < this->m_keys.Count(); i++)
+                this->m_sparse.Set(this->m_keys[i], IndexType::INVALID_INDEX);
+            this->m_keys.Clear();
+        }
+
+        /// キーの密配列を取得します。
+        /// @return キーの密配列です。
+        const Array<U32> &Keys() const noexcept
+        {
+            return this->m_keys;
+        }
+
+        /// 先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_keys.begin();
+        }
+
+        /// 終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_keys.end();
+        }
+    };
+
+    /// 整数キーで値を管理するスパースセットです。
+    /// 追加、削除、検索はO(1)で、値は密配列で連続して走査できます。
+    /// @tparam T 値の型です。
+    /// @tparam A 値の密配列のアロケータの型です。
+    /// @tparam PAGE_SIZE 疎配列の1ページの要素数です。(2の累乗)
+    /// @warning 削除で末尾の要素が削除位置に移動するため、要素の順序は保たれません。
+    template<typename T, typename A = Allocator<T>, USize PAGE_SIZE = 1024>
+    class SparseSet
+    {
+        using IndexType = _Internal::SparseIndex<PAGE_SIZE>;
+
+    public:
+        /// 値の型です。
+        using ElementType = T;
+        /// アロケータの型です。
+        using AllocatorType = A;
+        /// 可変イテレータの型です。
+        using IteratorType = typename Array<T, A>::IteratorType;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = typename Array<T, A>::ConstIteratorType;
+
+    private:
+        IndexType   m_sparse; // キーから密配列の位置を引く疎配列です。
+        Array<U32>  m_keys;   // キーの密配列です。
+        Array<T, A> m_values; // 値の密配列です。(m_keysと同じ順序)
+
+    public:
+        /// 初期化します。
+        /// @param allocator 値の密配列のアロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        SparseSet(const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_sparse()
+            , m_keys()
+            , m_values(allocator)
+        {}
+
+        /// ムーブします。
+        /// @param origin ムーブ元です。
+        SparseSet(SparseSet<T, A, PAGE_SIZE> &&origin) noexcept = default;
+
+        /// 要素数を取得します。
+        /// @return 要素数です。
+        USize Count() const noexcept
+        {
+            return this->m_keys.Count();
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->m_keys.IsEmpty();
+        }
+
+        /// キーが存在するか判定します。
+        /// @param key キーです。
+        /// @return 存在する場合、真です。
+        Bool Contains(U32 key) const noexcept
+        {
+            return this->m_sparse.Get(key) != IndexType::INVALID_INDEX;
+        }
+
+        /// 要素を追加します。キーが既に存在する場合、何もしません。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @return 追加した場合、真です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename VV>
+        Bool Add(U32 key, VV &&value) noexcept
+        {
+            if (this->Contains(key))
+                return false;
+            this->m_sparse.Set(key, (U32) this->m_keys.Count());
+            this->m_keys.Add(key);
+            this->m_values.Add(Forward<VV>(value));
+            return true;
+        }
+
+        /// 要素を設定します。キーが既に存在する場合、値を上書きします。
+        /// @param key キーです。
+        /// @param value 値です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        template<typename VV>
+        void Set(U32 key, VV &&value) noexcept
+        {
+            auto index = this->m_sparse.Get(key);
+            if (index != IndexType::INVALID_INDEX)
+                this->m_values[index] = Forward<VV>(value);
+            else
+                this->Add(key, Forward<VV>(value));
+        }
+
+        /// 値を検索します。
+        /// @param key キーです。
+        /// @return 値のポインタ、または、ヌルです。
+        T *Find(U32 key) noexcept
+        {
+            auto index = this->m_sparse.Get(key);
+            return index != IndexType::INVALID_INDEX ? &this->m_values[index]
+                                                     : nullptr;
+        }
+
+        /// 値を検索します。
+        /// @param key キーです。
+        /// @return 値のポインタ、または、ヌルです。
+        const T *Find(U32 key) const noexcept
+        {
+            auto index = this->m_sparse.Get(key);
+            return index != IndexType::INVALID_INDEX ? &this->m_values[index]
+                                                     : nullptr;
+        }
+
+        /// 要素を削除します。
+        /// @param key キーです。
+        /// @return 削除した場合、真です。
+        Bool Remove(U32 key) noexcept
+        {
+            auto index = this->m_sparse.Get(key);
+            if (index == IndexType::INVALID_INDEX)
+                return false;
+            auto lastKey = this->m_keys[this->m_keys.Count() - 1];
+            this->m_sparse.Set(lastKey, index);
+            this->m_sparse.Set(key, IndexType::INVALID_INDEX);
+            this->m_keys.RemoveAtSwapLast(index);
+            this->m_values.RemoveAtSwapLast(index);
+            return true;
+        }
+
+        /// 全要素を削除します。確保済みのメモリは保持します。
+        void Clear() noexcept
+        {
+            for (USize i = 0; i < this->m_keys.Count(); i++)
+                this->m_sparse.Set(this->m_keys[i], IndexType::INVALID_INDEX);
+            this->m_keys.Clear();
+            this->m_values.Clear();
+        }
+
+        /// キーの密配列を取得します。値の密配列と同じ順序です。
+        /// @return キーの密配列です。
+        const Array<U32> &Keys() const noexcept
+        {
+            return this->m_keys;
+        }
+
+        /// 値の密配列を取得します。キーの密配列と同じ順序です。
+        /// @return 値の密配列です。
+        Array<T, A> &Values() noexcept
+        {
+            return this->m_values;
+        }
+
+        /// 値の密配列を取得します。キーの密配列と同じ順序です。
+        /// @return 値の密配列です。
+        const Array<T, A> &Values() const noexcept
+        {
+            return this->m_values;
+        }
+
+        /// 値の先頭のイテレータを取得します。
+        /// @return 先頭のイテレータです。
+        IteratorType begin() noexcept
+        {
+            return this->m_values.begin();
+        }
+
+        /// 値の終端のイテレータを取得します。
+        /// @return 終端のイテレータです。
+        IteratorType end() noexcept
+        {
+            return this->m_values.end();
+        }
+
+        /// 値の先頭の不変イテレータを取得します。
+        /// @return 先頭の不変イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return this->m_values.begin();
+        }
+
+        /// 値の終端の不変イテレータを取得します。
+        /// @return 終端の不変イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return this->m_values.end();
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_SPARSESET_HPP
\ No newline at end of file
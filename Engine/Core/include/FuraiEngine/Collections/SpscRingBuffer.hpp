@@ -0,0 +1,144 @@
+/// @file FuraiEngine/Collections/SpscRingBuffer.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 単一生産者単一消費者のロックフリーリングバッファを提供します。
+#ifndef _FURAIENGINE_COLLECTIONS_SPSCRINGBUFFER_HPP
+#define _FURAIENGINE_COLLECTIONS_SPSCRINGBUFFER_HPP
+#include <atomic>
+#include <new>
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Memory.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 単一生産者単一消費者のロックフリーリングバッファです。
+    /// 追加、取り出しはブロックせず、メモリ確保も行いません。
+    /// @tparam T 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @warning 追加は1つのスレッドから、取り出しは別の1つのスレッドからのみ行えます。
+    template<typename T, typename A = Allocator<T>>
+    class SpscRingBuffer
+    {
+    public:
+        /// 要素の型です。
+        using ElementType = T;
+        /// アロケータの型です。
+        using AllocatorType = A;
+
+    private:
+        // 消費者が更新する値です。
+        alignas(CACHE_LINE_SIZE) std::atomic<USize> m_head; // 次に取り出す位置です。
+        USize m_cachedTail; // 消費者が最後に読んだ追加位置です。
+
+        // 生産者が更新する値です。
+        alignas(CACHE_LINE_SIZE) std::atomic<USize> m_tail; // 次に追加する位置です。
+        USize m_cachedHead; // 生産者が最後に読んだ取り出し位置です。
+
+        // 変更されない値です。
+        alignas(CACHE_LINE_SIZE) USize m_capacity; // 容量です。(2の累乗)
+        USize         m_mask;                      // 位置を容量内に収めるマスクです。
+        AllocatorType m_allocator;
+        ElementType  *m_pBuffer;
+
+    public:
+        /// 容量を指定して初期化します。
+        /// @param capacity 容量です。2の累乗に切り上げます。
+        /// @param allocator アロケータです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        SpscRingBuffer(USize                capacity,
+                       const AllocatorType &allocator = AllocatorType()) noexcept
+            : m_head(0)
+            , m_cachedTail(0)
+            , m_tail(0)
+            , m_cachedHead(0)
+            , m_capacity((USize) NextPowerOfTwo(capacity))
+            , m_mask(m_capacity - 1)
+            , m_allocator(allocator)
+            , m_pBuffer(nullptr)
+        {
+            if (!this->m_allocator
+                     .Allocate(this->m_capacity)
+                     .IsSuccess(this->m_pBuffer))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'SpscRingBuffer<{}>::SpscRingBuffer(USize "
+                             "capacity, const {} &allocator) noexcept'"),
+                         TypenameOf<T>(),
+                         TypenameOf<AllocatorType>());
+
+                ExitError();
+            }
+        }
+
+        SpscRingBuffer(const SpscRingBuffer<T, A> &)            = delete;
+        SpscRingBuffer<T, A> &operator=(const SpscRingBuffer<T, A> &) = delete;
+
+        /// 解体します。
+        /// @warning 他のスレッドが使用していない状態で解体してください。
+        ~SpscRingBuffer() noexcept
+        {
+            auto head = this->m_head.load(std::memory_order_relaxed);
+            auto tail = this->m_tail.load(std::memory_order_relaxed);
+            for (; head != tail; head++)
+                this->m_pBuffer[head & this->m_mask].~T();
+            static_cast<void>(this->m_allocator.Deallocate(
+                this->m_pBuffer, this->m_capacity));
+        }
+
+        /// 容量を取得します。
+        /// @return 容量です。
+        USize Capacity() const noexcept
+        {
+            return this->m_capacity;
+        }
+
+        /// 要素数を取得します。
+        /// @return 要素数です。他スレッドの操作中は概算値です。
+        USize Count() const noexcept
+        {
+            auto tail = this->m_tail.load(std::memory_order_acquire);
+            auto head = this->m_head.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        /// 要素を追加します。生産者スレッドからのみ呼び出せます。
+        /// @param value 追加する要素です。
+        /// @return 追加した場合、真です。満杯の場合、偽です。
+        template<typename TT>
+        Bool TryPush(TT &&value) noexcept
+        {
+            auto tail = this->m_tail.load(std::memory_order_relaxed);
+            if (tail - this->m_cachedHead == this->m_capacity)
+            {
+                this->m_cachedHead =
+                    this->m_head.load(std::memory_order_acquire);
+                if (tail - this->m_cachedHead == this->m_capacity)
+                    return false;
+            }
+            new (&this->m_pBuffer[tail & this->m_mask]) T(Forward<TT>(value));
+            this->m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// 要素を取り出します。消費者スレッドからのみ呼び出せます。
+        /// @param value 取り出した要素を受け取る参照です。
+        /// @return 取り出した場合、真です。空の場合、偽です。
+        Bool TryPop(T &value) noexcept
+        {
+            auto head = this->m_head.load(std::memory_order_relaxed);
+            if (head == this->m_cachedTail)
+            {
+                this->m_cachedTail =
+                    this->m_tail.load(std::memory_order_acquire);
+                if (head == this->m_cachedTail)
+                    return false;
+            }
+            auto &element = this->m_pBuffer[head & this->m_mask];
+            value         = Move(element);
+            element.~T();
+            this->m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+    };
+}
+#endif // !_FURAIENGINE_COLLECTIONS_SPSCRINGBUFFER_HPP
\ No newline at end of file
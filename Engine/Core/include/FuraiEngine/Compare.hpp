@@ -0,0 +1,128 @@
+/// @file FuraiEngine/Compare.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 比較関数オブジェクトを提供します。
+#ifndef _FURAIENGINE_COMPARE_HPP
+#define _FURAIENGINE_COMPARE_HPP
+#include <type_traits>
+#include "FuraiEngine/Primitive.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 関数オブジェクトが異種型の引数に対応しているか判定します。
+        template<typename F, typename = void>
+        struct HasIsTransparent : std::false_type
+        {};
+
+        /// 関数オブジェクトが異種型の引数に対応しているか判定します。
+        template<typename F>
+        struct HasIsTransparent<
+            F,
+            decltype((void) sizeof(typename F::IsTransparent *))>
+            : std::true_type
+        {};
+
+        /// 検索キーの型を決定します。
+        /// 関数オブジェクトが異種型の引数に対応していない場合、常にキーの型です。
+        /// @tparam K キーの型です。
+        /// @tparam Q 検索に使用する型です。
+        /// @tparam F 関数オブジェクトの型です。
+        template<typename K, typename Q, typename F>
+        using TransparentKeyType =
+            typename std::conditional<HasIsTransparent<F>::value, Q, K>::type;
+    }
+    /// @endcond
+
+    /// 同等比較関数オブジェクトです。
+    /// @tparam T 比較する型です。
+    template<typename T>
+    class EqualTo
+    {
+    public:
+        /// 同等か比較します。
+        /// @param l 比較対象です。
+        /// @param r 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator()(const T &l, const T &r) const noexcept
+        {
+            return l == r;
+        }
+    };
+
+    /// 異なる型同士を比較する同等比較関数オブジェクトです。
+    /// コンテナの異種型検索に使用します。
+    template<>
+    class EqualTo<void>
+    {
+    public:
+        /// 異種型検索に対応していることを示します。
+        using IsTransparent = void;
+
+        /// 同等か比較します。
+        /// @param l 比較対象です。
+        /// @param r 比較対象です。
+        /// @return 同等の場合、真です。
+        template<typename L, typename R>
+        Bool operator()(const L &l, const R &r) const noexcept
+        {
+            return l == r;
+        }
+    };
+
+    /// 小なり比較関数オブジェクトです。
+    /// @tparam T 比較する型です。
+    template<typename T>
+    class Less
+    {
+    public:
+        /// 左辺が右辺より小さいか比較します。
+        /// @param l 比較対象です。
+        /// @param r 比較対象です。
+        /// @return 左辺が小さい場合、真です。
+        Bool operator()(const T &l, const T &r) const noexcept
+        {
+            return l < r;
+        }
+    };
+
+    /// 異なる型同士を比較する小なり比較関数オブジェクトです。
+    /// コンテナの異種型検索に使用します。
+    template<>
+    class Less<void>
+    {
+    public:
+        /// 異種型検索に対応していることを示します。
+        using IsTransparent = void;
+
+        /// 左辺が右辺より小さいか比較します。
+        /// @param l 比較対象です。
+        /// @param r 比較対象です。
+        /// @return 左辺が小さい場合、真です。
+        template<typename L, typename R>
+        Bool operator()(const L &l, const R &r) const noexcept
+        {
+            return l < r;
+        }
+    };
+
+    /// 大なり比較関数オブジェクトです。
+    /// @tparam T 比較する型です。
+    template<typename T>
+    class Greater
+    {
+    public:
+        /// 左辺が右辺より大きいか比較します。
+        /// @param l 比較対象です。
+        /// @param r 比較対象です。
+        /// @return 左辺が大きい場合、真です。
+        Bool operator()(const T &l, const T &r) const noexcept
+        {
+            return r < l;
+        }
+    };
+}
+#endif // !_FURAIENGINE_COMPARE_HPP
\ No newline at end of file
@@ -0,0 +1,120 @@
+/// @file FuraiEngine/Hash.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// ハッシュ関数を提供します。
+#ifndef _FURAIENGINE_HASH_HPP
+#define _FURAIENGINE_HASH_HPP
+#include <type_traits>
+#include "FuraiEngine/Compare.hpp"
+#include "FuraiEngine/Primitive.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// ハッシュコンテナの検索キーの型を決定します。
+        /// ハッシュ関数と同等比較関数が異種型検索に対応していない場合、常にキーの型です。
+        /// @tparam K キーの型です。
+        /// @tparam Q 検索に使用する型です。
+        /// @tparam H ハッシュ関数の型です。
+        /// @tparam E 同等比較関数の型です。
+        template<typename K, typename Q, typename H, typename E>
+        using LookupKeyType =
+            typename std::conditional<HasIsTransparent<H>::value
+                                          && HasIsTransparent<E>::value,
+                                      Q,
+                                      K>::type;
+    }
+    /// @endcond
+
+    /// ハッシュ値を攪拌し、全ビットに偏りなく分散させます。
+    /// @param hash 攪拌するハッシュ値です。
+    /// @return 攪拌したハッシュ値です。
+    constexpr U64 MixHash(U64 hash) noexcept
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /// バイト列のハッシュ値を計算します。(FNV-1a)
+    /// @param pointer バイト列の先頭です。
+    /// @param size バイト数です。
+    /// @return ハッシュ値です。
+    inline U64 HashBytes(const void *pointer, USize size) noexcept
+    {
+        auto pBytes = (const U8 *) pointer;
+        U64  hash   = 0xCBF29CE484222325ULL;
+        for (USize i = 0; i < size; i++)
+        {
+            hash ^= pBytes[i];
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    /// ハッシュ関数オブジェクトです。
+    /// 独自の型は特殊化して対応させます。
+    /// @tparam T ハッシュ値を計算する型です。
+    template<typename T, typename = void>
+    class Hash;
+
+    /// 整数、列挙型のハッシュ関数オブジェクトです。
+    /// @tparam T ハッシュ値を計算する型です。
+    template<typename T>
+    class Hash<
+        T,
+        typename std::enable_if<std::is_integral<T>::value
+                                || std::is_enum<T>::value>::type>
+    {
+    public:
+        /// ハッシュ値を計算します。
+        /// @param value 対象の値です。
+        /// @return ハッシュ値です。
+        USize operator()(T value) const noexcept
+        {
+            return (USize) value;
+        }
+    };
+
+    /// 浮動小数点型のハッシュ関数オブジェクトです。
+    /// @tparam T ハッシュ値を計算する型です。
+    template<typename T>
+    class Hash<
+        T,
+        typename std::enable_if<std::is_floating_point<T>::value>::type>
+    {
+    public:
+        /// ハッシュ値を計算します。
+        /// @param value 対象の値です。
+        /// @return ハッシュ値です。
+        USize operator()(T value) const noexcept
+        {
+            if (value == 0) // +0と-0を同じ値とします。
+                return 0;
+            return (USize) HashBytes(&value, sizeof(T));
+        }
+    };
+
+    /// ポインタ型のハッシュ関数オブジェクトです。
+    /// 参照先ではなく、アドレス値からハッシュ値を計算します。
+    /// @tparam T 参照先の型です。
+    template<typename T>
+    class Hash<T *>
+    {
+    public:
+        /// ハッシュ値を計算します。
+        /// @param value 対象の値です。
+        /// @return ハッシュ値です。
+        USize operator()(const T *value) const noexcept
+        {
+            return (USize) value;
+        }
+    };
+}
+#endif // !_FURAIENGINE_HASH_HPP
\ No newline at end of file
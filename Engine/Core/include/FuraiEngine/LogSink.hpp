@@ -0,0 +1,172 @@
+/// @file FuraiEngine/LogSink.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// ログの出力先を提供します。
+#ifndef _FURAIENGINE_LOGSINK_HPP
+#define _FURAIENGINE_LOGSINK_HPP
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include "FuraiEngine/String.hpp"
+#include "FuraiEngine/Utility.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// ログの出力先です。
+    /// 書き込みスレッドが、複数の行をまとめた文字の並びで呼び出します。
+    class LogSink
+    {
+    public:
+        /// 解体します。
+        virtual ~LogSink() noexcept = default;
+
+        /// 行の並びを書き込みます。書き込みスレッドから呼び出されます。
+        /// 行の途中で分割されるのは、1行がまとめる領域より長い場合のみです。
+        /// @param pData 文字の並びです。
+        /// @param size 文字数です。
+        virtual void Write(const Char *pData, USize size) noexcept = 0;
+
+        /// 書き込んだ内容を確定します。
+        /// 書き込みスレッドが溜まった記録を出し切るたびに呼び出されます。
+        virtual void Flush() noexcept
+        {}
+    };
+
+    /// ログの出力先を追加します。
+    /// ログシステムの初期化前に1つも追加しない場合、'Log.txt'へ出力するFileLogSinkを使用します。
+    /// @param pSink 出力先です。
+    /// @warning 出力先はRemoveLogSinkで取り除くか、プログラムの終了まで存在する必要があります。
+    /// @warning 出力先の数がLOG_SINKS_MAXを超えた場合、異常終了します。
+    void AddLogSink(LogSink *pSink) noexcept;
+
+    /// ログの出力先を取り除きます。
+    /// 戻った後、出力先は書き込みスレッドから呼び出されません。
+    /// @param pSink 出力先です。
+    void RemoveLogSink(LogSink *pSink) noexcept;
+
+    /// 追加できるログの出力先の最大数です。
+    constexpr USize LOG_SINKS_MAX = 16;
+
+    /// ファイルへ出力するログの出力先です。
+    /// 大きさ、または、経過時間でファイルを切り替えます。
+    /// 切り替えたファイルは'path.1'、'path.2'...へ名前を変えて残し、古いものから削除します。
+    class FileLogSink final : public LogSink
+    {
+        String      m_path;         // ファイルのパスです。
+        FILE       *m_pFile;        // ファイルです。
+        USize       m_size;         // 現在のファイルの大きさです。
+        USize       m_maxSize;      // 切り替える大きさです。0の場合、切り替えません。
+        U64         m_interval;     // 切り替える経過秒数です。0の場合、切り替えません。
+        USize       m_backupsCount; // 残すファイルの数です。
+        std::time_t m_openedTime;   // ファイルを開いた時間です。
+
+        /// ファイルを開きます。
+        void _Open() noexcept;
+
+        /// ファイルを切り替えます。
+        void _Rotate() noexcept;
+
+    public:
+        /// 初期化し、ファイルを作成します。既にある場合、内容を破棄します。
+        /// @param path ファイルのパスです。
+        /// @param maxSize 切り替える大きさです。0の場合、大きさで切り替えません。
+        /// @param interval 切り替える経過秒数です。0の場合、時間で切り替えません。
+        /// @param backupsCount 切り替え後に残すファイルの数です。
+        FileLogSink(const Char *path,
+                    USize       maxSize      = 0,
+                    U64         interval     = 0,
+                    USize       backupsCount = 3) noexcept;
+
+        FileLogSink(const FileLogSink &)            = delete;
+        FileLogSink &operator=(const FileLogSink &) = delete;
+
+        /// 解体し、ファイルを閉じます。
+        ~FileLogSink() noexcept override;
+
+        /// 行の並びを書き込みます。
+        /// 大きさで切り替える場合、行の区切りで分割して切り替えます。
+        /// @param pData 文字の並びです。
+        /// @param size 文字数です。
+        void Write(const Char *pData, USize size) noexcept override;
+
+        /// 書き込んだ内容をファイルへ反映します。
+        void Flush() noexcept override;
+    };
+
+    /// 標準エラー出力へ出力するログの出力先です。
+    class StderrLogSink final : public LogSink
+    {
+    public:
+        /// 行の並びを書き込みます。
+        /// @param pData 文字の並びです。
+        /// @param size 文字数です。
+        void Write(const Char *pData, USize size) noexcept override;
+
+        /// 書き込んだ内容を標準エラー出力へ反映します。
+        void Flush() noexcept override;
+    };
+
+    /// メモリ上のリングバッファへ出力するログの出力先です。
+    /// 最新の容量分の出力を保持し、クラッシュ時の情報収集などに使用します。
+    class MemoryLogSink final : public LogSink
+    {
+        mutable std::mutex m_mutexF;   // 読み書きのための占有ロックフラグです。
+        Char              *m_pData;    // 保持する文字の並びです。
+        USize              m_capacity; // 容量です。
+        U64                m_position; // これまでに書き込んだ文字数です。
+
+    public:
+        /// 容量を指定して初期化します。
+        /// @param capacity 容量です。0の場合、1として扱います。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        MemoryLogSink(USize capacity) noexcept;
+
+        MemoryLogSink(const MemoryLogSink &)            = delete;
+        MemoryLogSink &operator=(const MemoryLogSink &) = delete;
+
+        /// 解体します。
+        ~MemoryLogSink() noexcept override;
+
+        /// 行の並びを書き込みます。容量を超えた分は古いものから上書きします。
+        /// @param pData 文字の並びです。
+        /// @param size 文字数です。
+        void Write(const Char *pData, USize size) noexcept override;
+
+        /// 保持する最新の出力を複写します。
+        /// @param pData 複写先です。
+        /// @param size 複写先の大きさです。
+        /// @return 複写した文字数です。
+        USize Read(Char *pData, USize size) const noexcept;
+    };
+
+    /// メモリマップしたファイルをリングバッファとして出力するログの出力先です。
+    /// 書き込みはメモリへの複写のみで、プロセスが異常終了しても書き込んだ内容はOSがファイルへ反映します。
+    /// ファイルは64バイトのヘッダに続けて容量分の領域を持ちます。
+    /// ヘッダは'FURAILOG'の8バイト、容量(U64)、これまでに書き込んだ文字数(U64)の順です。
+    class MappedFileLogSink final : public LogSink
+    {
+        void *m_pFile;          // ファイルのハンドルです。
+        void *m_pMappingObject; // ファイルマッピングのハンドルです。(Windowsのみ)
+        U8   *m_pView;          // マップした領域です。
+        USize m_capacity;       // 容量です。
+
+    public:
+        /// 初期化し、ファイルを作成してマップします。既にある場合、内容を破棄します。
+        /// 失敗した場合、書き込みは破棄されます。
+        /// @param path ファイルのパスです。
+        /// @param capacity 容量です。
+        MappedFileLogSink(const Char *path, USize capacity) noexcept;
+
+        MappedFileLogSink(const MappedFileLogSink &)            = delete;
+        MappedFileLogSink &operator=(const MappedFileLogSink &) = delete;
+
+        /// 解体し、マップを解除します。
+        ~MappedFileLogSink() noexcept override;
+
+        /// 行の並びを書き込みます。容量を超えた分は古いものから上書きします。
+        /// @param pData 文字の並びです。
+        /// @param size 文字数です。
+        void Write(const Char *pData, USize size) noexcept override;
+    };
+}
+#endif // !_FURAIENGINE_LOGSINK_HPP
\ No newline at end of file
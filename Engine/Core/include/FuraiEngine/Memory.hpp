@@ -8,6 +8,10 @@
 /// FuraiEngineのすべての機能を含む名前空間です。
 namespace FuraiEngine
 {
+    /// キャッシュラインのサイズです。
+    /// スレッド間で共有する変数をこの境界に揃え、偽共有を防ぎます。
+    constexpr USize CACHE_LINE_SIZE = 64;
+
     /// メモリ確保に失敗した場合のエラー型です。
     enum class EBadAllocatedError : U8
     {
@@ -83,10 +87,15 @@ namespace FuraiEngine
         /// @param size 確保する要素数です。
         /// @return 確保したメモリのポインタ、または、エラー値です。
         Result<ElementType *, BadAllocatedErrorType>
-        Allocate(Usize count) noexcept
+        Allocate(USize count) noexcept
         {
-            return (ElementType *) FuraiEngine::Allocate(
-                sizeof(ElementType) * count);
+            void                 *pointer = nullptr;
+            BadAllocatedErrorType error   = BadAllocatedErrorType::ZERO_SIZE;
+            if (FuraiEngine::Allocate(sizeof(ElementType) * count)
+                    .IsSuccess(pointer, error))
+                return (ElementType *) pointer;
+            else
+                return Move(error);
         }
 
         /// メモリを解放します。
@@ -96,7 +105,9 @@ namespace FuraiEngine
         Result<Success, BadAllocatedErrorType>
         Deallocate(ElementType *pointer, USize count) noexcept
         {
-            return FuraiEngine::Deallocate((void *) pointer, count);
+            return FuraiEngine::Deallocate(
+                (void *) pointer,
+                sizeof(ElementType) * count);
         }
     };
 
@@ -0,0 +1,200 @@
+/// @file FuraiEngine/Name.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// インターン化された名前を提供します。
+#ifndef _FURAIENGINE_NAME_HPP
+#define _FURAIENGINE_NAME_HPP
+#include <type_traits>
+#include "FuraiEngine/StringView.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 名前のハッシュ値を計算します。(FNV-1a)
+        /// コンパイル時と実行時で同じ値になります。
+        /// @param pText 文字列の先頭です。
+        /// @param count バイト数です。
+        /// @return ハッシュ値です。
+        constexpr U64 HashNameText(const Char *pText, USize count) noexcept
+        {
+            U64 hash = 0xCBF29CE484222325ULL;
+            for (USize i = 0; i < count; i++)
+            {
+                hash ^= (U8) pText[i];
+                hash *= 0x100000001B3ULL;
+            }
+            return hash;
+        }
+    }
+    /// @endcond
+
+    /// ハッシュ値を計算済みの名前の文字列です。
+    /// 文字列リテラルから名前を作る際、実行時のハッシュ計算を省きます。
+    class NameLiteral
+    {
+        StringView m_text; // 文字列です。
+        U64        m_hash; // ハッシュ値です。
+
+    public:
+        /// 文字列リテラルから初期化します。
+        /// @param text 文字列リテラルです。
+        template<USize N>
+        constexpr NameLiteral(const Char (&text)[N]) noexcept
+            : m_text(text, N - 1)
+            , m_hash(_Internal::HashNameText(text, N - 1))
+        {
+        }
+
+        /// ハッシュ値を指定して初期化します。
+        /// @param text 文字列リテラルです。
+        /// @param hash 文字列のハッシュ値です。
+        template<USize N>
+        constexpr NameLiteral(const Char (&text)[N], U64 hash) noexcept
+            : m_text(text, N - 1)
+            , m_hash(hash)
+        {
+        }
+
+        /// 文字列を取得します。
+        /// @return 文字列です。
+        constexpr StringView Text() const noexcept
+        {
+            return this->m_text;
+        }
+
+        /// ハッシュ値を取得します。
+        /// @return ハッシュ値です。
+        constexpr U64 HashValue() const noexcept
+        {
+            return this->m_hash;
+        }
+    };
+
+    /// インターン化された名前です。
+    /// 文字列は一度だけハッシュ化されて全体共有の表に登録され、以後は32ビットの識別子として比較、ハッシュ化されます。
+    /// 登録された文字列はプロセスの終了まで解放されません。
+    class Name
+    {
+        U32 m_id; // 名前の識別子です。0は空の名前です。
+
+        /// 文字列を登録し、識別子を取得します。
+        /// @param text 文字列です。
+        /// @param hash 文字列のハッシュ値です。
+        /// @return 識別子です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        static U32 _Intern(StringView text, U64 hash) noexcept;
+
+    public:
+        /// 空の名前で初期化します。
+        constexpr Name() noexcept
+            : m_id(0)
+        {
+        }
+
+        /// 文字列から初期化します。
+        /// @param text 文字列です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        explicit Name(StringView text) noexcept
+            : m_id(_Intern(text,
+                           _Internal::HashNameText(text.Data(), text.Count())))
+        {
+        }
+
+        /// ハッシュ値を計算済みの文字列から初期化します。
+        /// @param literal ハッシュ値を計算済みの文字列です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        Name(const NameLiteral &literal) noexcept
+            : m_id(_Intern(literal.Text(), literal.HashValue()))
+        {
+        }
+
+        /// 識別子を取得します。
+        /// @return 識別子です。プロセス内でのみ有効です。
+        U32 Id() const noexcept
+        {
+            return this->m_id;
+        }
+
+        /// 空の名前か判定します。
+        /// @return 空の場合、真です。
+        Bool IsNone() const noexcept
+        {
+            return this->m_id == 0;
+        }
+
+        /// 文字列を取得します。ロックしません。
+        /// @return ヌル終端された文字列です。
+        StringView Text() const noexcept;
+
+        /// 同等か比較します。
+        /// @param other 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator==(Name other) const noexcept
+        {
+            return this->m_id == other.m_id;
+        }
+
+        /// 不等か比較します。
+        /// @param other 比較対象です。
+        /// @return 不等の場合、真です。
+        Bool operator!=(Name other) const noexcept
+        {
+            return this->m_id != other.m_id;
+        }
+
+        /// 識別子の順で小さいか比較します。文字列の順ではありません。
+        /// @param other 比較対象です。
+        /// @return 小さい場合、真です。
+        Bool operator<(Name other) const noexcept
+        {
+            return this->m_id < other.m_id;
+        }
+    };
+
+    /// 名前のハッシュ関数オブジェクトです。
+    template<>
+    class Hash<Name>
+    {
+    public:
+        /// ハッシュ値を計算します。
+        /// @param value 対象の値です。
+        /// @return ハッシュ値です。
+        USize operator()(Name value) const noexcept
+        {
+            return (USize) value.Id();
+        }
+    };
+
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 名前を文字列として書き込みます。
+        template<>
+        struct LogArgument<Name>
+        {
+            static void Write(Logger &logger, Name value) noexcept
+            {
+                auto text = value.Text();
+                WriteLogString(logger, text.Data(), text.Count());
+            }
+        };
+    }
+    /// @endcond
+}
+
+/// 文字列リテラルから名前を作ります。ハッシュ値は必ずコンパイル時に計算します。
+/// @code
+/// static const Name PLAYER = FURAIENGINE_NAME(TXT("Player"));
+/// @endcode
+#define FURAIENGINE_NAME(S)                                               \
+    ::FuraiEngine::Name(::FuraiEngine::NameLiteral(                       \
+        S,                                                                \
+        std::integral_constant<::FuraiEngine::U64,                        \
+                               ::FuraiEngine::_Internal::HashNameText(    \
+                                   S,                                     \
+                                   sizeof(S) - 1)>::value))
+#endif // !_FURAIENGINE_NAME_HPP
\ No newline at end of file
@@ -26,4 +26,81 @@
 /// 標準文字列にエンコードします。
 #define TXT(S) u8##S
 
+#if __cplusplus >= 202002L
+/// C++20以降の場合'consteval'、それ以外は'constexpr'を付加します。
+#define FURAIENGINE_CONSTEVAL consteval
+#else
+/// C++20以降の場合'consteval'、それ以外は'constexpr'を付加します。
+#define FURAIENGINE_CONSTEVAL constexpr
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/// SSE2命令が使用可能な場合に定義されます。
+#define FURAIENGINE_SIMD_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+/// SSSE3命令が使用可能な場合に定義されます。
+#define FURAIENGINE_SIMD_SSSE3 1
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+/// NEON命令が使用可能な場合に定義されます。
+#define FURAIENGINE_SIMD_NEON 1
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+/// 64ビットARMのNEON命令(表引き命令を含みます)が使用可能な場合に定義されます。
+#define FURAIENGINE_SIMD_NEON64 1
+#endif
+
+/// 境界検査を行いません。
+#define FURAIENGINE_BOUNDS_CHECK_NONE 0
+/// 境界検査を行い、違反した場合は出力せずに異常終了します。
+#define FURAIENGINE_BOUNDS_CHECK_ASSERT 1
+/// 境界検査を行い、違反した場合は位置と要素数をログに出力して異常終了します。
+#define FURAIENGINE_BOUNDS_CHECK_FULL 2
+
+#if !defined(FURAIENGINE_BOUNDS_CHECK)
+#if defined(NDEBUG)
+/// 配列、イテレータの境界検査の方針です。
+/// ビルド設定で定義しない場合、NDEBUGが定義されていればFURAIENGINE_BOUNDS_CHECK_NONE、それ以外はFURAIENGINE_BOUNDS_CHECK_FULLです。
+/// @warning 同じプログラム内のすべての翻訳単位で同じ値にしてください。イテレータの大きさが変わります。
+#define FURAIENGINE_BOUNDS_CHECK FURAIENGINE_BOUNDS_CHECK_NONE
+#else
+/// 配列、イテレータの境界検査の方針です。
+/// ビルド設定で定義しない場合、NDEBUGが定義されていればFURAIENGINE_BOUNDS_CHECK_NONE、それ以外はFURAIENGINE_BOUNDS_CHECK_FULLです。
+/// @warning 同じプログラム内のすべての翻訳単位で同じ値にしてください。イテレータの大きさが変わります。
+#define FURAIENGINE_BOUNDS_CHECK FURAIENGINE_BOUNDS_CHECK_FULL
+#endif
+#endif
+
+/// 追跡用の詳細なログの重要度です。
+#define FURAIENGINE_LOG_LEVEL_TRACE 0
+/// 開発用のログの重要度です。
+#define FURAIENGINE_LOG_LEVEL_VERBOSE 1
+/// 通常のログの重要度です。
+#define FURAIENGINE_LOG_LEVEL_LOG 2
+/// 警告の重要度です。
+#define FURAIENGINE_LOG_LEVEL_WARNING 3
+/// エラーの重要度です。
+#define FURAIENGINE_LOG_LEVEL_ERROR 4
+/// すべてのログを取り除く重要度です。
+#define FURAIENGINE_LOG_LEVEL_NONE 5
+
+#if !defined(FURAIENGINE_LOG_LEVEL)
+#if defined(NDEBUG)
+/// コンパイル時に残すログの最小の重要度です。
+/// これ未満の重要度のログは、引数の評価を含めて取り除かれます。
+/// ビルド設定で定義しない場合、NDEBUGが定義されていればFURAIENGINE_LOG_LEVEL_LOG、それ以外はFURAIENGINE_LOG_LEVEL_TRACEです。
+#define FURAIENGINE_LOG_LEVEL FURAIENGINE_LOG_LEVEL_LOG
+#else
+/// コンパイル時に残すログの最小の重要度です。
+/// これ未満の重要度のログは、引数の評価を含めて取り除かれます。
+/// ビルド設定で定義しない場合、NDEBUGが定義されていればFURAIENGINE_LOG_LEVEL_LOG、それ以外はFURAIENGINE_LOG_LEVEL_TRACEです。
+#define FURAIENGINE_LOG_LEVEL FURAIENGINE_LOG_LEVEL_TRACE
+#endif
+#endif
+
 #endif // !_FURAIENGINE_PREPROCESS_HPP
\ No newline at end of file
@@ -5,6 +5,8 @@
 #ifndef _FURAIENGINE_PRIMITIVE_HPP
 #define _FURAIENGINE_PRIMITIVE_HPP
 
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include "FuraiEngine/Preprocess.hpp"
 
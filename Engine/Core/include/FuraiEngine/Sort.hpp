@@ -0,0 +1,869 @@
+/// @file FuraiEngine/Sort.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 配列の整列を提供します。
+#ifndef _FURAIENGINE_SORT_HPP
+#define _FURAIENGINE_SORT_HPP
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include "FuraiEngine/Collections/Span.hpp"
+#include "FuraiEngine/Compare.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 挿入ソートに切り替える要素数です。
+        constexpr USize INSERTION_SORT_THRESHOLD = 16;
+        /// 安定ソートで最初に挿入ソートする区間の要素数です。
+        constexpr USize STABLE_SORT_RUN_SIZE = 32;
+        /// 基数ソートの代わりに比較ソートを使用する要素数です。
+        constexpr USize RADIX_SORT_THRESHOLD = 64;
+        /// 並列ソートで1スレッドが受け持つ最小の要素数です。
+        constexpr USize PARALLEL_SORT_GRAIN = 16 * 1024;
+        /// 基数ソートの1桁のビット数です。
+        constexpr USize RADIX_BITS = 8;
+        /// 基数ソートの1桁の値の数です。
+        constexpr USize RADIX_SIZE = 1 << RADIX_BITS;
+
+        /// 要素を交換します。
+        /// @param l 交換する要素です。
+        /// @param r 交換する要素です。
+        template<typename T>
+        void SwapElements(T &l, T &r) noexcept
+        {
+            auto rrTmp = Move(l);
+            l          = Move(r);
+            r          = Move(rrTmp);
+        }
+
+        /// 挿入ソートで整列します。安定です。
+        /// @param pFirst 先頭です。
+        /// @param count 要素数です。
+        /// @param compare 比較関数です。
+        template<typename T, typename C>
+        void InsertionSort(T *pFirst, USize count, const C &compare) noexcept
+        {
+            for (USize i = 1; i < count; i++)
+            {
+                if (!compare(pFirst[i], pFirst[i - 1]))
+                    continue;
+                auto  rrValue = Move(pFirst[i]);
+                USize j       = i;
+                do
+                {
+                    pFirst[j] = Move(pFirst[j - 1]);
+                    j--;
+                } while (j > 0 && compare(rrValue, pFirst[j - 1]));
+                pFirst[j] = Move(rrValue);
+            }
+        }
+
+        /// ヒープソートで整列します。クイックソートが偏った場合に使用します。
+        /// @param pFirst 先頭です。
+        /// @param count 要素数です。
+        /// @param compare 比較関数です。
+        template<typename T, typename C>
+        void HeapSort(T *pFirst, USize count, const C &compare) noexcept
+        {
+            auto siftDown = [&](USize index, USize heapCount) noexcept {
+                while (true)
+                {
+                    auto child = index * 2 + 1;
+                    if (child >= heapCount)
+                        break;
+                    if (child + 1 < heapCount
+                        && compare(pFirst[child], pFirst[child + 1]))
+                        child++;
+                    if (!compare(pFirst[index], pFirst[child]))
+                        break;
+                    SwapElements(pFirst[index], pFirst[child]);
+                    index = child;
+                }
+            };
+            for (auto i = count / 2; i > 0; i--)
+                siftDown(i - 1, count);
+            for (auto i = count; i > 1; i--)
+            {
+                SwapElements(pFirst[0], pFirst[i - 1]);
+                siftDown(0, i - 1);
+            }
+        }
+
+        /// イントロソートで整列します。
+        /// 3点の中央値を軸にクイックソートし、再帰が深くなった区間はヒープソート、小さな区間は挿入ソートします。
+        /// @param pFirst 先頭です。
+        /// @param count 要素数です。
+        /// @param depth 残りの再帰の深さです。
+        /// @param compare 比較関数です。
+        template<typename T, typename C>
+        void IntroSort(T *pFirst, USize count, USize depth, const C &compare) noexcept
+        {
+            while (count > INSERTION_SORT_THRESHOLD)
+            {
+                if (depth == 0)
+                {
+                    HeapSort(pFirst, count, compare);
+                    return;
+                }
+                depth--;
+
+                // 先頭の次、中央、末尾を整列し、中央値を先頭に置いて軸にします。
+                auto middle = count / 2;
+                if (compare(pFirst[middle], pFirst[1]))
+                    SwapElements(pFirst[middle], pFirst[1]);
+                if (compare(pFirst[count - 1], pFirst[middle]))
+                {
+                    SwapElements(pFirst[count - 1], pFirst[middle]);
+                    if (compare(pFirst[middle], pFirst[1]))
+                        SwapElements(pFirst[middle], pFirst[1]);
+                }
+                SwapElements(pFirst[0], pFirst[middle]);
+
+                // 末尾は軸以上、先頭は軸自身の為、範囲の確認なしで走査できます。
+                USize i = 1;
+                USize j = count - 1;
+                while (true)
+                {
+                    while (compare(pFirst[i], pFirst[0]))
+                        i++;
+                    while (compare(pFirst[0], pFirst[j]))
+                        j--;
+                    if (i >= j)
+                        break;
+                    SwapElements(pFirst[i], pFirst[j]);
+                    i++;
+                    j--;
+                }
+                SwapElements(pFirst[0], pFirst[j]);
+
+                // 小さい方を再帰し、大きい方をループで処理して再帰を浅く保ちます。
+                auto leftCount  = j;
+                auto rightCount = count - j - 1;
+                if (leftCount < rightCount)
+                {
+                    IntroSort(pFirst, leftCount, depth, compare);
+                    pFirst += j + 1;
+                    count = rightCount;
+                }
+                else
+                {
+                    IntroSort(pFirst + j + 1, rightCount, depth, compare);
+                    count = leftCount;
+                }
+            }
+            InsertionSort(pFirst, count, compare);
+        }
+
+        /// イントロソートの再帰の深さの上限を計算します。
+        /// @param count 要素数です。
+        /// @return 再帰の深さの上限です。
+        constexpr USize IntroSortDepthOf(USize count) noexcept
+        {
+            USize depth = 0;
+            for (; count > 1; count >>= 1)
+                depth += 2;
+            return depth;
+        }
+
+        /// 隣接する2つの整列済みの区間を併合します。安定です。
+        /// @param pFirst 前の区間の先頭です。
+        /// @param leftCount 前の区間の要素数です。
+        /// @param count 2つの区間の合計の要素数です。
+        /// @param pBuffer 前の区間の要素数以上の未初期化の作業領域です。
+        /// @param compare 比較関数です。
+        template<typename T, typename C>
+        void MergeRuns(T       *pFirst,
+                       USize    leftCount,
+                       USize    count,
+                       T       *pBuffer,
+                       const C &compare) noexcept
+        {
+            if (leftCount == 0 || leftCount == count
+                || !compare(pFirst[leftCount], pFirst[leftCount - 1]))
+                return;
+            for (USize i = 0; i < leftCount; i++)
+                new (&pBuffer[i]) T(Move(pFirst[i]));
+            USize i = 0;
+            USize j = leftCount;
+            USize k = 0;
+            while (i < leftCount && j < count)
+            {
+                if (compare(pFirst[j], pBuffer[i]))
+                    pFirst[k++] = Move(pFirst[j++]);
+                else
+                    pFirst[k++] = Move(pBuffer[i++]);
+            }
+            while (i < leftCount)
+                pFirst[k++] = Move(pBuffer[i++]);
+            for (USize l = 0; l < leftCount; l++)
+                pBuffer[l].~T();
+        }
+
+        /// 整列用の未初期化の作業領域です。
+        /// @tparam T 要素の型です。
+        template<typename T>
+        class SortBuffer
+        {
+            T    *m_pData;  // 作業領域です。
+            USize m_count;  // 要素数です。
+
+        public:
+            /// 作業領域を確保します。
+            /// @param count 要素数です。
+            /// @warning メモリ確保に失敗した場合、異常終了します。
+            SortBuffer(USize count) noexcept
+                : m_pData(nullptr)
+                , m_count(count)
+            {
+                if (count != 0
+                    && !Allocator<T>().Allocate(count).IsSuccess(this->m_pData))
+                {
+                    LogError(TXT("メモリの確保に失敗しました。"
+                                 "'SortBuffer<T>::SortBuffer(USize count) "
+                                 "noexcept'"));
+
+                    ExitError();
+                }
+            }
+
+            /// 作業領域を解放します。
+            ~SortBuffer() noexcept
+            {
+                if (this->m_pData != nullptr)
+                    static_cast<void>(Allocator<T>().Deallocate(
+                        this->m_pData, this->m_count));
+            }
+
+            SortBuffer(const SortBuffer<T> &)                  = delete;
+            SortBuffer<T> &operator=(const SortBuffer<T> &) = delete;
+
+            /// 作業領域の先頭を取得します。
+            /// @return 作業領域の先頭です。
+            T *Data() const noexcept
+            {
+                return this->m_pData;
+            }
+        };
+
+        /// 並列ソートのスレッドの同期点です。
+        class SortBarrier
+        {
+            std::mutex              m_mutexF;     // 同期の占有ロックフラグです。
+            std::condition_variable m_condition;
+            USize                   m_count;      // 同期するスレッド数です。
+            USize                   m_waiting;    // 待機中のスレッド数です。
+            USize                   m_generation; // 同期した回数です。
+
+        public:
+            /// 初期化します。
+            /// @param count 同期するスレッド数です。
+            SortBarrier(USize count) noexcept
+                : m_mutexF()
+                , m_condition()
+                , m_count(count)
+                , m_waiting(0)
+                , m_generation(0)
+            {
+            }
+
+            /// すべてのスレッドが到達するまで待機します。
+            void Wait() noexcept
+            {
+                std::unique_lock<std::mutex> lock(this->m_mutexF);
+                auto generation = this->m_generation;
+                if (++this->m_waiting == this->m_count)
+                {
+                    this->m_waiting = 0;
+                    this->m_generation++;
+                    this->m_condition.notify_all();
+                }
+                else
+                {
+                    this->m_condition.wait(lock, [&]() noexcept {
+                        return generation != this->m_generation;
+                    });
+                }
+            }
+        };
+
+        /// 並列ソートのスレッド数を決定します。
+        /// @param count 要素数です。
+        /// @param threadsCount 指定されたスレッド数です。0の場合、論理コア数です。
+        /// @return スレッド数です。
+        inline USize SortThreadsCountOf(USize count, USize threadsCount) noexcept
+        {
+            if (threadsCount == 0)
+                threadsCount = (USize) std::thread::hardware_concurrency();
+            auto limit = count / PARALLEL_SORT_GRAIN;
+            if (threadsCount > limit)
+                threadsCount = limit;
+            return threadsCount > 0 ? threadsCount : 1;
+        }
+
+        /// 区間をスレッド数で等分した際の先頭の位置を計算します。
+        /// @param count 要素数です。
+        /// @param threadsCount スレッド数です。
+        /// @param index スレッドの番号です。
+        /// @return 先頭の位置です。
+        constexpr USize SortChunkBeginOf(USize count,
+                                         USize threadsCount,
+                                         USize index) noexcept
+        {
+            return (USize) ((unsigned long long) count * index / threadsCount);
+        }
+
+        /// 作業を複数のスレッドで実行します。呼び出し元のスレッドは番号0を実行します。
+        /// @param threadsCount スレッド数です。
+        /// @param work スレッドの番号を受け取る作業です。
+        template<typename F>
+        void RunSortWorkers(USize threadsCount, const F &work) noexcept
+        {
+            std::thread *pThreads = nullptr;
+            if (!Allocator<std::thread>()
+                     .Allocate(threadsCount - 1)
+                     .IsSuccess(pThreads))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'void RunSortWorkers(USize threadsCount, const "
+                             "F &work) noexcept'"));
+
+                ExitError();
+            }
+            for (USize i = 1; i < threadsCount; i++)
+                new (&pThreads[i - 1]) std::thread([&work, i]() noexcept {
+                    work(i);
+                });
+            work(0);
+            for (USize i = 1; i < threadsCount; i++)
+            {
+                pThreads[i - 1].join();
+                pThreads[i - 1].~thread();
+            }
+            static_cast<void>(Allocator<std::thread>().Deallocate(
+                pThreads, threadsCount - 1));
+        }
+
+        /// 要素をそのまま基数ソートのキーとする関数オブジェクトです。
+        class RadixIdentity
+        {
+        public:
+            /// キーを取得します。
+            /// @param value 要素です。
+            /// @return キーです。
+            template<typename T>
+            constexpr T operator()(const T &value) const noexcept
+            {
+                return value;
+            }
+        };
+
+        /// 符号なし整数のキーを、順序を保った符号なし整数に変換します。
+        /// @param key キーです。
+        /// @return 変換した値です。
+        template<typename K>
+        constexpr typename std::enable_if<std::is_unsigned<K>::value, K>::type
+        RadixEncode(K key) noexcept
+        {
+            return key;
+        }
+
+        /// 符号付き整数のキーを、符号ビットを反転して順序を保った符号なし整数に変換します。
+        /// @param key キーです。
+        /// @return 変換した値です。
+        template<typename K>
+        constexpr typename std::enable_if<
+            std::is_integral<K>::value && std::is_signed<K>::value,
+            typename std::make_unsigned<K>::type>::type
+        RadixEncode(K key) noexcept
+        {
+            using UnsignedType = typename std::make_unsigned<K>::type;
+            return (UnsignedType) key
+                 ^ (UnsignedType) ((UnsignedType) 1 << (sizeof(K) * 8 - 1));
+        }
+
+        /// 浮動小数点数のキーを、順序を保った符号なし整数に変換します。
+        /// 負の値は全ビットを、正の値は符号ビットを反転します。
+        /// @param key キーです。
+        /// @return 変換した値です。
+        inline U32 RadixEncode(F32 key) noexcept
+        {
+            U32 bits;
+            std::memcpy(&bits, &key, sizeof(U32));
+            return (bits & 0x80000000U) != 0 ? ~bits : bits | 0x80000000U;
+        }
+
+        /// 浮動小数点数のキーを、順序を保った符号なし整数に変換します。
+        /// 負の値は全ビットを、正の値は符号ビットを反転します。
+        /// @param key キーです。
+        /// @return 変換した値です。
+        inline U64 RadixEncode(F64 key) noexcept
+        {
+            U64 bits;
+            std::memcpy(&bits, &key, sizeof(U64));
+            return (bits & 0x8000000000000000ULL) != 0
+                     ? ~bits
+                     : bits | 0x8000000000000000ULL;
+        }
+
+        /// 要素から変換済みのキーを取り出した型です。
+        /// @tparam T 要素の型です。
+        /// @tparam P キーを取り出す関数の型です。
+        template<typename T, typename P>
+        using RadixKeyType = decltype(RadixEncode(
+            std::declval<const P &>()(std::declval<const T &>())));
+
+        /// 基数ソートの桁ごとの度数です。
+        /// @tparam K 変換済みのキーの型です。
+        template<typename K>
+        class RadixHistogram
+        {
+        public:
+            /// 桁数です。
+            static constexpr USize DIGITS_COUNT = sizeof(K);
+
+            /// 桁ごとの度数です。
+            USize counts[DIGITS_COUNT][RADIX_SIZE];
+
+            /// 度数を0で初期化します。
+            RadixHistogram() noexcept
+                : counts {}
+            {
+            }
+
+            /// 区間の全桁の度数を数えます。
+            /// @param pFirst 先頭です。
+            /// @param count 要素数です。
+            /// @param project キーを取り出す関数です。
+            template<typename T, typename P>
+            void Add(const T *pFirst, USize count, const P &project) noexcept
+            {
+                for (USize i = 0; i < count; i++)
+                {
+                    K key = RadixEncode(project(pFirst[i]));
+                    for (USize d = 0; d < DIGITS_COUNT; d++)
+                        this->counts[d][(key >> (d * RADIX_BITS)) & 0xFF]++;
+                }
+            }
+        };
+
+        /// 基数ソートの1桁分を、度数から計算した位置へ移動します。
+        /// @param pSource 移動元です。
+        /// @param count 要素数です。
+        /// @param pDestination 移動先です。
+        /// @param digit 桁です。
+        /// @param pOffsets 値ごとの移動先の位置です。移動した分だけ進めます。
+        /// @param project キーを取り出す関数です。
+        template<typename K, typename T, typename P>
+        void RadixScatter(const T *pSource,
+                          USize    count,
+                          T       *pDestination,
+                          USize    digit,
+                          USize   *pOffsets,
+                          const P &project) noexcept
+        {
+            auto shift = digit * RADIX_BITS;
+            for (USize i = 0; i < count; i++)
+            {
+                K key = RadixEncode(project(pSource[i]));
+                pDestination[pOffsets[(key >> shift) & 0xFF]++] = pSource[i];
+            }
+        }
+
+        /// 並べ替えが必要な桁か判定します。全要素が同じ値の桁は省略できます。
+        /// @param pCounts 桁の度数です。
+        /// @param count 要素数です。
+        /// @return 必要な場合、真です。
+        inline Bool IsRadixDigitNeeded(const USize *pCounts, USize count) noexcept
+        {
+            for (USize v = 0; v < RADIX_SIZE; v++)
+            {
+                if (pCounts[v] != 0)
+                    return pCounts[v] != count;
+            }
+            return false;
+        }
+
+        /// 変換済みのキーで比較する関数オブジェクトです。
+        /// @tparam P キーを取り出す関数の型です。
+        template<typename P>
+        class RadixKeyLess
+        {
+            const P &m_project;
+
+        public:
+            /// 初期化します。
+            /// @param project キーを取り出す関数です。
+            RadixKeyLess(const P &project) noexcept
+                : m_project(project)
+            {
+            }
+
+            /// 左辺のキーが右辺のキーより小さいか比較します。
+            /// @param l 比較対象です。
+            /// @param r 比較対象です。
+            /// @return 左辺が小さい場合、真です。
+            template<typename T>
+            Bool operator()(const T &l, const T &r) const noexcept
+            {
+                return RadixEncode(this->m_project(l))
+                     < RadixEncode(this->m_project(r));
+            }
+        };
+    }
+    /// @endcond
+
+    /// 整列します。安定ではありません。
+    /// イントロソートの為、最悪でもO(N log N)です。
+    /// @tparam T 要素の型です。
+    /// @tparam C 比較関数の型です。
+    /// @param span 整列する範囲です。
+    /// @param compare 比較関数です。
+    template<typename T, typename C = Less<T>>
+    void Sort(Span<T> span, const C &compare = C()) noexcept
+    {
+        _Internal::IntroSort(span.Data(),
+                             span.Count(),
+                             _Internal::IntroSortDepthOf(span.Count()),
+                             compare);
+    }
+
+    /// 整列します。安定ではありません。
+    /// @tparam T 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @tparam C 比較関数の型です。
+    /// @param array 整列する配列です。
+    /// @param compare 比較関数です。
+    template<typename T, typename A, typename C = Less<T>>
+    void Sort(Array<T, A> &array, const C &compare = C()) noexcept
+    {
+        Sort(Span<T>(array), compare);
+    }
+
+    /// 同等の要素の順序を保って整列します。
+    /// 短い区間を挿入ソートした後、作業領域を使用して併合します。
+    /// @tparam T 要素の型です。
+    /// @tparam C 比較関数の型です。
+    /// @param span 整列する範囲です。
+    /// @param compare 比較関数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename C = Less<T>>
+    void StableSort(Span<T> span, const C &compare = C()) noexcept
+    {
+        auto pFirst = span.Data();
+        auto count  = span.Count();
+        for (USize i = 0; i < count; i += _Internal::STABLE_SORT_RUN_SIZE)
+        {
+            auto rest = count - i;
+            _Internal::InsertionSort(pFirst + i,
+                                     rest < _Internal::STABLE_SORT_RUN_SIZE
+                                         ? rest
+                                         : _Internal::STABLE_SORT_RUN_SIZE,
+                                     compare);
+        }
+        if (count <= _Internal::STABLE_SORT_RUN_SIZE)
+            return;
+
+        _Internal::SortBuffer<T> buffer(count);
+        for (auto width = _Internal::STABLE_SORT_RUN_SIZE; width < count;
+             width *= 2)
+        {
+            for (USize i = 0; i + width < count; i += width * 2)
+            {
+                auto rest = count - i;
+                _Internal::MergeRuns(pFirst + i,
+                                     width,
+                                     rest < width * 2 ? rest : width * 2,
+                                     buffer.Data(),
+                                     compare);
+            }
+        }
+    }
+
+    /// 同等の要素の順序を保って整列します。
+    /// @tparam T 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @tparam C 比較関数の型です。
+    /// @param array 整列する配列です。
+    /// @param compare 比較関数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename A, typename C = Less<T>>
+    void StableSort(Array<T, A> &array, const C &compare = C()) noexcept
+    {
+        StableSort(Span<T>(array), compare);
+    }
+
+    /// 整数、または、浮動小数点数のキーで基数ソートします。安定です。
+    /// 8ビットずつ下位の桁から度数を数えて移動し、全要素が同じ値の桁は省略します。
+    /// 浮動小数点数は-0.0を0.0より小さいとみなします。
+    /// @tparam T 要素の型です。自明にコピー可能である必要があります。
+    /// @tparam P キーを取り出す関数の型です。
+    /// @param span 整列する範囲です。
+    /// @param project 要素からキーを取り出す関数です。既定では要素自身です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename P = _Internal::RadixIdentity>
+    void RadixSort(Span<T> span, const P &project = P()) noexcept
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "RadixSort requires trivially copyable elements.");
+        using KeyType = _Internal::RadixKeyType<T, P>;
+
+        auto count = span.Count();
+        if (count < _Internal::RADIX_SORT_THRESHOLD)
+        {
+            StableSort(span, _Internal::RadixKeyLess<P>(project));
+            return;
+        }
+
+        _Internal::RadixHistogram<KeyType> histogram;
+        histogram.Add(span.Data(), count, project);
+
+        _Internal::SortBuffer<T> buffer(count);
+        T                       *pSource      = span.Data();
+        T                       *pDestination = buffer.Data();
+        for (USize d = 0; d < _Internal::RadixHistogram<KeyType>::DIGITS_COUNT;
+             d++)
+        {
+            auto pCounts = histogram.counts[d];
+            if (!_Internal::IsRadixDigitNeeded(pCounts, count))
+                continue;
+            USize offsets[_Internal::RADIX_SIZE];
+            USize sum = 0;
+            for (USize v = 0; v < _Internal::RADIX_SIZE; v++)
+            {
+                offsets[v] = sum;
+                sum += pCounts[v];
+            }
+            _Internal::RadixScatter<KeyType>(pSource,
+                                             count,
+                                             pDestination,
+                                             d,
+                                             offsets,
+                                             project);
+            auto pTmp    = pSource;
+            pSource      = pDestination;
+            pDestination = pTmp;
+        }
+        if (pSource != span.Data())
+            std::memcpy((void *) span.Data(), pSource, sizeof(T) * count);
+    }
+
+    /// 整数、または、浮動小数点数のキーで基数ソートします。安定です。
+    /// @tparam T 要素の型です。自明にコピー可能である必要があります。
+    /// @tparam A アロケータの型です。
+    /// @tparam P キーを取り出す関数の型です。
+    /// @param array 整列する配列です。
+    /// @param project 要素からキーを取り出す関数です。既定では要素自身です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename A, typename P = _Internal::RadixIdentity>
+    void RadixSort(Array<T, A> &array, const P &project = P()) noexcept
+    {
+        RadixSort(Span<T>(array), project);
+    }
+
+    /// 複数のスレッドで整列します。安定ではありません。
+    /// 範囲をスレッド数で分割して各スレッドで整列し、隣接する区間を並列に併合します。
+    /// 要素数が少ない場合は呼び出し元のスレッドのみで整列します。
+    /// @tparam T 要素の型です。
+    /// @tparam C 比較関数の型です。比較関数は複数のスレッドから同時に呼び出されます。
+    /// @param span 整列する範囲です。
+    /// @param compare 比較関数です。
+    /// @param threadsCount スレッド数です。0の場合、論理コア数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename C = Less<T>>
+    void ParallelSort(Span<T>  span,
+                      const C &compare      = C(),
+                      USize    threadsCount = 0) noexcept
+    {
+        auto count = span.Count();
+        threadsCount = _Internal::SortThreadsCountOf(count, threadsCount);
+        if (threadsCount == 1)
+        {
+            Sort(span, compare);
+            return;
+        }
+
+        auto                     pFirst = span.Data();
+        _Internal::SortBuffer<T> buffer(count);
+        _Internal::SortBarrier   barrier(threadsCount);
+        _Internal::RunSortWorkers(threadsCount, [&](USize index) noexcept {
+            auto begin =
+                _Internal::SortChunkBeginOf(count, threadsCount, index);
+            auto end =
+                _Internal::SortChunkBeginOf(count, threadsCount, index + 1);
+            Sort(Span<T>(pFirst + begin, end - begin), compare);
+
+            // 幅を倍にしながら、隣接する区間の組を各組の先頭のスレッドで併合します。
+            for (USize width = 1; width < threadsCount; width *= 2)
+            {
+                barrier.Wait();
+                if (index % (width * 2) != 0 || index + width >= threadsCount)
+                    continue;
+                auto last  = index + width * 2 < threadsCount ? index + width * 2
+                                                              : threadsCount;
+                auto middle =
+                    _Internal::SortChunkBeginOf(count, threadsCount, index + width);
+                auto finish =
+                    _Internal::SortChunkBeginOf(count, threadsCount, last);
+                _Internal::MergeRuns(pFirst + begin,
+                                     middle - begin,
+                                     finish - begin,
+                                     buffer.Data() + begin,
+                                     compare);
+            }
+        });
+    }
+
+    /// 複数のスレッドで整列します。安定ではありません。
+    /// @tparam T 要素の型です。
+    /// @tparam A アロケータの型です。
+    /// @tparam C 比較関数の型です。比較関数は複数のスレッドから同時に呼び出されます。
+    /// @param array 整列する配列です。
+    /// @param compare 比較関数です。
+    /// @param threadsCount スレッド数です。0の場合、論理コア数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename A, typename C = Less<T>>
+    void ParallelSort(Array<T, A> &array,
+                      const C     &compare      = C(),
+                      USize        threadsCount = 0) noexcept
+    {
+        ParallelSort(Span<T>(array), compare, threadsCount);
+    }
+
+    /// 複数のスレッドで基数ソートします。安定です。
+    /// 各桁について、スレッドごとに受け持つ区間の度数を数え、スレッド順に移動先を割り当てて並列に移動します。
+    /// 要素数が少ない場合は呼び出し元のスレッドのみで整列します。
+    /// @tparam T 要素の型です。自明にコピー可能である必要があります。
+    /// @tparam P キーを取り出す関数の型です。関数は複数のスレッドから同時に呼び出されます。
+    /// @param span 整列する範囲です。
+    /// @param project 要素からキーを取り出す関数です。
+    /// @param threadsCount スレッド数です。0の場合、論理コア数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename P = _Internal::RadixIdentity>
+    void ParallelRadixSort(Span<T>  span,
+                           const P &project      = P(),
+                           USize    threadsCount = 0) noexcept
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "ParallelRadixSort requires trivially copyable elements.");
+        using KeyType       = _Internal::RadixKeyType<T, P>;
+        using HistogramType = _Internal::RadixHistogram<KeyType>;
+
+        auto count = span.Count();
+        threadsCount = _Internal::SortThreadsCountOf(count, threadsCount);
+        if (threadsCount == 1)
+        {
+            RadixSort(span, project);
+            return;
+        }
+
+        _Internal::SortBuffer<T>             buffer(count);
+        _Internal::SortBuffer<HistogramType> histograms(threadsCount);
+        _Internal::SortBuffer<USize> offsets(threadsCount * _Internal::RADIX_SIZE);
+        _Internal::SortBarrier       barrier(threadsCount);
+        USize digits[HistogramType::DIGITS_COUNT]; // 並べ替えが必要な桁です。
+        USize digitsCount = 0;
+        _Internal::RunSortWorkers(threadsCount, [&](USize index) noexcept {
+            auto begin =
+                _Internal::SortChunkBeginOf(count, threadsCount, index);
+            auto end =
+                _Internal::SortChunkBeginOf(count, threadsCount, index + 1);
+            auto pHistogram = new (histograms.Data() + index) HistogramType();
+            auto pOffsets   = offsets.Data() + index * _Internal::RADIX_SIZE;
+            pHistogram->Add(span.Data() + begin, end - begin, project);
+            barrier.Wait();
+
+            // 全体の度数から並べ替えが必要な桁を決めます。
+            if (index == 0)
+            {
+                for (USize d = 0; d < HistogramType::DIGITS_COUNT; d++)
+                {
+                    HistogramType total;
+                    for (USize t = 0; t < threadsCount; t++)
+                    {
+                        for (USize v = 0; v < _Internal::RADIX_SIZE; v++)
+                            total.counts[0][v] += histograms.Data()[t].counts[d][v];
+                    }
+                    if (_Internal::IsRadixDigitNeeded(total.counts[0], count))
+                        digits[digitsCount++] = d;
+                }
+            }
+            barrier.Wait();
+
+            T *pSource      = span.Data();
+            T *pDestination = buffer.Data();
+            for (USize p = 0; p < digitsCount; p++)
+            {
+                auto d = digits[p];
+                // 最初の桁は並べ替え前の度数をそのまま使用できます。
+                if (p != 0)
+                {
+                    auto pCounts = pHistogram->counts[d];
+                    for (USize v = 0; v < _Internal::RADIX_SIZE; v++)
+                        pCounts[v] = 0;
+                    auto shift = d * _Internal::RADIX_BITS;
+                    for (auto i = begin; i < end; i++)
+                    {
+                        KeyType key = _Internal::RadixEncode(project(pSource[i]));
+                        pCounts[(key >> shift) & 0xFF]++;
+                    }
+                }
+                barrier.Wait();
+
+                // 値の順、同じ値の中ではスレッドの順に移動先を割り当てます。
+                if (index == 0)
+                {
+                    USize sum = 0;
+                    for (USize v = 0; v < _Internal::RADIX_SIZE; v++)
+                    {
+                        for (USize t = 0; t < threadsCount; t++)
+                        {
+                            offsets.Data()[t * _Internal::RADIX_SIZE + v] = sum;
+                            sum += histograms.Data()[t].counts[d][v];
+                        }
+                    }
+                }
+                barrier.Wait();
+
+                _Internal::RadixScatter<KeyType>(pSource + begin,
+                                                 end - begin,
+                                                 pDestination,
+                                                 d,
+                                                 pOffsets,
+                                                 project);
+                barrier.Wait();
+                auto pTmp    = pSource;
+                pSource      = pDestination;
+                pDestination = pTmp;
+            }
+            if (pSource != span.Data())
+                std::memcpy((void *) (span.Data() + begin),
+                            pSource + begin,
+                            sizeof(T) * (end - begin));
+            pHistogram->~HistogramType();
+        });
+    }
+
+    /// 複数のスレッドで基数ソートします。安定です。
+    /// @tparam T 要素の型です。自明にコピー可能である必要があります。
+    /// @tparam A アロケータの型です。
+    /// @tparam P キーを取り出す関数の型です。関数は複数のスレッドから同時に呼び出されます。
+    /// @param array 整列する配列です。
+    /// @param project 要素からキーを取り出す関数です。
+    /// @param threadsCount スレッド数です。0の場合、論理コア数です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    template<typename T, typename A, typename P = _Internal::RadixIdentity>
+    void ParallelRadixSort(Array<T, A> &array,
+                           const P     &project      = P(),
+                           USize        threadsCount = 0) noexcept
+    {
+        ParallelRadixSort(Span<T>(array), project, threadsCount);
+    }
+}
+#endif // !_FURAIENGINE_SORT_HPP
\ No newline at end of file
@@ -0,0 +1,332 @@
+/// @file FuraiEngine/String.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 短文字列最適化を行うUTF-8文字列を提供します。
+#ifndef _FURAIENGINE_STRING_HPP
+#define _FURAIENGINE_STRING_HPP
+#include "FuraiEngine/StringView.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// UTF-8文字列です。
+    /// 短い文字列(64ビット環境で23バイトまで)はヒープを使用せず、インスタンス内に格納します。
+    /// 長い文字列は標準アロケータで確保します。常にヌル終端を保持します。
+    /// @warning リトルエンディアン環境を前提とします。
+    class String
+    {
+    public:
+        /// 文字の型です。
+        using ElementType = Char;
+        /// イテレータの型です。
+        using IteratorType = PointerIterator<Char>;
+        /// 不変イテレータの型です。
+        using ConstIteratorType = ConstPointerIterator<Char>;
+
+        /// インスタンス内に格納できる最大バイト数です。
+        static constexpr USize LOCAL_CAPACITY = sizeof(USize) * 3 - 1;
+
+    private:
+        /// ヒープ使用時を示すフラグです。容量の最上位ビットに格納します。
+        static constexpr USize HEAP_FLAG = (USize) 1 << (sizeof(USize) * 8 - 1);
+
+        /// ヒープ使用時のデータです。
+        class HeapData
+        {
+        public:
+            Char *pData;    // 先頭の文字です。
+            USize count;    // バイト数です。
+            USize capacity; // 容量です。(HEAP_FLAGを含みます)
+        };
+
+        union
+        {
+            HeapData m_heap;                       // ヒープ使用時のデータです。
+            Char     m_local[LOCAL_CAPACITY + 1]; // インスタンス内の文字列です。
+        };
+        // インスタンス内に格納している場合、m_local[LOCAL_CAPACITY]は残り容量です。
+        // 満杯のときに0となり、そのままヌル終端を兼ねます。
+        // ヒープ使用時、同じバイトはHEAP_FLAGにより最上位ビットが立ちます。
+
+        /// インスタンス内に格納しているか判定します。
+        Bool _IsLocal() const noexcept
+        {
+            return (((const U8 *) this->m_local)[LOCAL_CAPACITY] & 0x80) == 0;
+        }
+
+        /// インスタンス内の文字列のバイト数を設定します。
+        void _SetLocalCount(USize count) noexcept
+        {
+            this->m_local[count]          = 0;
+            this->m_local[LOCAL_CAPACITY] = (Char) (LOCAL_CAPACITY - count);
+        }
+
+        /// バイト数を設定し、ヌル終端を書き込みます。
+        void _SetCount(USize count) noexcept;
+
+        /// 容量を変更し、文字列を追加します。
+        /// 追加する文字列は自身の一部であっても構いません。
+        /// @param capacity 新しい容量です。
+        /// @param append 追加する文字列です。
+        void _Reallocate(USize capacity, StringView append) noexcept;
+
+        /// ヒープの領域を解放します。
+        void _Release() noexcept;
+
+    public:
+        /// 空の文字列で初期化します。
+        String() noexcept;
+
+        /// ヌル終端文字列から初期化します。
+        /// @param string ヌル終端文字列です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String(const Char *string) noexcept;
+
+        /// 文字列の参照から初期化します。
+        /// @param string 文字列の参照です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        explicit String(StringView string) noexcept;
+
+        /// コピーします。
+        /// @param origin コピー元です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String(const String &origin) noexcept;
+
+        /// ムーブします。ヒープの領域は所有権を移すだけで複製しません。
+        /// @param origin ムーブ元です。
+        String(String &&origin) noexcept;
+
+        /// 解体します。
+        ~String() noexcept;
+
+        /// コピー代入します。
+        /// @param origin コピー元です。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &operator=(const String &origin) noexcept;
+
+        /// ムーブ代入します。
+        /// @param origin ムーブ元です。
+        /// @return 自身のインスタンスです。
+        String &operator=(String &&origin) noexcept;
+
+        /// 文字列の参照を代入します。
+        /// @param string 文字列の参照です。自身の一部であっても構いません。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &operator=(StringView string) noexcept;
+
+        /// バイト数を取得します。
+        /// @return バイト数です。
+        USize Count() const noexcept
+        {
+            return this->_IsLocal()
+                     ? LOCAL_CAPACITY - (USize) this->m_local[LOCAL_CAPACITY]
+                     : this->m_heap.count;
+        }
+
+        /// 容量を取得します。
+        /// @return 再確保せずに格納できるバイト数です。
+        USize Capacity() const noexcept
+        {
+            return this->_IsLocal() ? LOCAL_CAPACITY
+                                    : this->m_heap.capacity & ~HEAP_FLAG;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        Bool IsEmpty() const noexcept
+        {
+            return this->Count() == 0;
+        }
+
+        /// 先頭の文字のポインタを取得します。
+        /// @return ヌル終端された先頭の文字のポインタです。
+        Char *Data() noexcept
+        {
+            return this->_IsLocal() ? this->m_local : this->m_heap.pData;
+        }
+
+        /// 先頭の文字のポインタを取得します。
+        /// @return ヌル終端された先頭の文字のポインタです。
+        const Char *Data() const noexcept
+        {
+            return this->_IsLocal() ? this->m_local : this->m_heap.pData;
+        }
+
+        /// 文字列の参照を取得します。
+        /// @return 文字列の参照です。
+        StringView View() const noexcept
+        {
+            return StringView(this->Data(), this->Count());
+        }
+
+        /// 文字列の参照へ変換します。
+        /// @return 文字列の参照です。
+        operator StringView() const noexcept
+        {
+            return this->View();
+        }
+
+        /// 文字にアクセスします。
+        /// @param index 位置です。(バイト)
+        /// @return 文字の参照です。
+        Char &operator[](USize index) noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->Count(),
+                TXT("Char &String::operator[](USize index) noexcept"));
+            return this->Data()[index];
+        }
+
+        /// 文字にアクセスします。
+        /// @param index 位置です。(バイト)
+        /// @return 文字です。
+        Char operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->Count(),
+                TXT("Char String::operator[](USize index) const noexcept"));
+            return this->Data()[index];
+        }
+
+        /// 容量を予約します。
+        /// @param capacity 予約するバイト数です。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        void Reserve(USize capacity) noexcept;
+
+        /// 空にします。容量は維持します。
+        void Clear() noexcept;
+
+        /// 文字列を追加します。
+        /// @param string 追加する文字列です。自身の一部であっても構いません。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &Append(StringView string) noexcept;
+
+        /// 文字を追加します。
+        /// @param character 追加する文字です。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &Append(Char character) noexcept;
+
+        /// 文字列を追加します。
+        /// @param string 追加する文字列です。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &operator+=(StringView string) noexcept
+        {
+            return this->Append(string);
+        }
+
+        /// 文字を追加します。
+        /// @param character 追加する文字です。
+        /// @return 自身のインスタンスです。
+        /// @warning メモリ確保に失敗した場合、異常終了します。
+        String &operator+=(Char character) noexcept
+        {
+            return this->Append(character);
+        }
+
+        /// 部分文字列を検索します。
+        /// @param string 検索する文字列です。
+        /// @param from 検索を開始する位置です。(バイト)
+        /// @return 見つかった位置です。見つからない場合、USIZE_MAXです。
+        USize Find(StringView string, USize from = 0) const noexcept
+        {
+            return this->View().Find(string, from);
+        }
+
+        /// 同等か比較します。
+        /// @param other 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator==(StringView other) const noexcept
+        {
+            return this->View() == other;
+        }
+
+        /// 不等か比較します。
+        /// @param other 比較対象です。
+        /// @return 不等の場合、真です。
+        Bool operator!=(StringView other) const noexcept
+        {
+            return this->View() != other;
+        }
+
+        /// バイト順で小さいか比較します。
+        /// @param other 比較対象です。
+        /// @return 小さい場合、真です。
+        Bool operator<(StringView other) const noexcept
+        {
+            return this->View() < other;
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() noexcept
+        {
+            return IteratorType(this->Data(),
+                                this->Data(),
+                                this->Data() + this->Count());
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() noexcept
+        {
+            return IteratorType(this->Data() + this->Count(),
+                                this->Data(),
+                                this->Data() + this->Count());
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        ConstIteratorType begin() const noexcept
+        {
+            return ConstIteratorType(this->Data(),
+                                     this->Data(),
+                                     this->Data() + this->Count());
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        ConstIteratorType end() const noexcept
+        {
+            return ConstIteratorType(this->Data() + this->Count(),
+                                     this->Data(),
+                                     this->Data() + this->Count());
+        }
+    };
+
+    /// 文字列を連結します。
+    /// @param left 左辺です。
+    /// @param right 右辺です。
+    /// @return 連結した文字列です。
+    /// @warning メモリ確保に失敗した場合、異常終了します。
+    String operator+(StringView left, StringView right) noexcept;
+
+    /// 文字列のハッシュ関数オブジェクトです。
+    /// 文字列の参照と同じハッシュ値を返します。
+    template<>
+    class Hash<String> : public Hash<StringView>
+    {
+    };
+
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 文字列を書き込みます。
+        template<>
+        struct LogArgument<String>
+        {
+            static void Write(Logger &logger, const String &value) noexcept
+            {
+                WriteLogString(logger, value.Data(), value.Count());
+            }
+        };
+    }
+    /// @endcond
+}
+#endif // !_FURAIENGINE_STRING_HPP
\ No newline at end of file
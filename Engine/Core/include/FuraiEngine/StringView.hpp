@@ -0,0 +1,256 @@
+/// @file FuraiEngine/StringView.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// 所有権を持たない文字列の参照を提供します。
+#ifndef _FURAIENGINE_STRINGVIEW_HPP
+#define _FURAIENGINE_STRINGVIEW_HPP
+#include <cstring>
+#include "FuraiEngine/Collections/Array.hpp"
+#include "FuraiEngine/Hash.hpp"
+#include "FuraiEngine/Unicode.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 所有権を持たないUTF-8文字列の参照です。
+    /// 長さを保持する為、終端のヌル文字を必要とせず、長さの再計算も行いません。
+    /// @warning 参照先より長く保持しないでください。
+    class StringView
+    {
+    public:
+        /// 文字の型です。
+        using ElementType = Char;
+        /// イテレータの型です。
+        using IteratorType = ConstPointerIterator<Char>;
+
+    private:
+        const Char *m_pData; // 先頭の文字です。
+        USize       m_count; // バイト数です。
+
+    public:
+        /// 空の文字列で初期化します。
+        constexpr StringView() noexcept
+            : m_pData(TXT(""))
+            , m_count(0)
+        {
+        }
+
+        /// ヌル終端文字列を参照します。
+        /// @param string ヌル終端文字列です。
+        StringView(const Char *string) noexcept
+            : m_pData(string)
+            , m_count(std::strlen((const char *) string))
+        {
+        }
+
+        /// 領域を指定して参照します。
+        /// @param pData 先頭の文字です。
+        /// @param count バイト数です。
+        constexpr StringView(const Char *pData, USize count) noexcept
+            : m_pData(pData)
+            , m_count(count)
+        {
+        }
+
+        /// バイト数を取得します。
+        /// @return バイト数です。
+        constexpr USize Count() const noexcept
+        {
+            return this->m_count;
+        }
+
+        /// 空か判定します。
+        /// @return 空の場合、真です。
+        constexpr Bool IsEmpty() const noexcept
+        {
+            return this->m_count == 0;
+        }
+
+        /// 先頭の文字のポインタを取得します。
+        /// @return 先頭の文字のポインタです。ヌル終端とは限りません。
+        constexpr const Char *Data() const noexcept
+        {
+            return this->m_pData;
+        }
+
+        /// 文字にアクセスします。
+        /// @param index 位置です。(バイト)
+        /// @return 文字です。
+        constexpr Char operator[](USize index) const noexcept
+        {
+            _Internal::CheckIndex(
+                index,
+                this->m_count,
+                TXT("Char StringView::operator[](USize index) const noexcept"));
+            return this->m_pData[index];
+        }
+
+        /// 部分文字列を取得します。
+        /// @param offset 先頭の位置です。(バイト)
+        /// @param count バイト数です。範囲を超える場合、末尾までです。
+        /// @return 部分文字列の参照です。
+        StringView Slice(USize offset, USize count = USIZE_MAX) const noexcept
+        {
+            if (offset > this->m_count)
+                offset = this->m_count;
+            auto rest = this->m_count - offset;
+            return StringView(this->m_pData + offset,
+                              count < rest ? count : rest);
+        }
+
+        /// 文字を検索します。
+        /// @param character 検索する文字です。
+        /// @param from 検索を開始する位置です。(バイト)
+        /// @return 見つかった位置です。見つからない場合、USIZE_MAXです。
+        USize Find(Char character, USize from = 0) const noexcept
+        {
+            if (from >= this->m_count)
+                return USIZE_MAX;
+            auto pFound = (const Char *) std::memchr(this->m_pData + from,
+                                                     (int) character,
+                                                     this->m_count - from);
+            return pFound != nullptr ? (USize) (pFound - this->m_pData)
+                                     : USIZE_MAX;
+        }
+
+        /// 部分文字列を検索します。
+        /// @param string 検索する文字列です。
+        /// @param from 検索を開始する位置です。(バイト)
+        /// @return 見つかった位置です。見つからない場合、USIZE_MAXです。
+        USize Find(StringView string, USize from = 0) const noexcept
+        {
+            if (from > this->m_count)
+                return USIZE_MAX;
+            auto index = FindText(this->m_pData + from,
+                                  this->m_count - from,
+                                  string.m_pData,
+                                  string.m_count);
+            return index != USIZE_MAX ? from + index : USIZE_MAX;
+        }
+
+        /// 部分文字列を含むか判定します。
+        /// @param string 検索する文字列です。
+        /// @return 含む場合、真です。
+        Bool Contains(StringView string) const noexcept
+        {
+            return this->Find(string) != USIZE_MAX;
+        }
+
+        /// 指定文字列で始まるか判定します。
+        /// @param string 比較する文字列です。
+        /// @return 始まる場合、真です。
+        Bool StartsWith(StringView string) const noexcept
+        {
+            return string.m_count <= this->m_count
+                && std::memcmp(this->m_pData, string.m_pData, string.m_count)
+                       == 0;
+        }
+
+        /// 指定文字列で終わるか判定します。
+        /// @param string 比較する文字列です。
+        /// @return 終わる場合、真です。
+        Bool EndsWith(StringView string) const noexcept
+        {
+            return string.m_count <= this->m_count
+                && std::memcmp(this->m_pData + this->m_count - string.m_count,
+                               string.m_pData,
+                               string.m_count)
+                       == 0;
+        }
+
+        /// バイト順で比較します。
+        /// @param other 比較対象です。
+        /// @return 自身が小さい場合は負、等しい場合は0、大きい場合は正の値です。
+        I32 CompareTo(StringView other) const noexcept
+        {
+            auto count  = this->m_count < other.m_count ? this->m_count
+                                                        : other.m_count;
+            auto result = count != 0
+                            ? std::memcmp(this->m_pData, other.m_pData, count)
+                            : 0;
+            if (result != 0)
+                return result;
+            if (this->m_count == other.m_count)
+                return 0;
+            return this->m_count < other.m_count ? -1 : 1;
+        }
+
+        /// 同等か比較します。
+        /// @param other 比較対象です。
+        /// @return 同等の場合、真です。
+        Bool operator==(StringView other) const noexcept
+        {
+            return this->m_count == other.m_count
+                && (this->m_count == 0
+                    || std::memcmp(this->m_pData, other.m_pData, this->m_count)
+                           == 0);
+        }
+
+        /// 不等か比較します。
+        /// @param other 比較対象です。
+        /// @return 不等の場合、真です。
+        Bool operator!=(StringView other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /// バイト順で小さいか比較します。
+        /// @param other 比較対象です。
+        /// @return 小さい場合、真です。
+        Bool operator<(StringView other) const noexcept
+        {
+            return this->CompareTo(other) < 0;
+        }
+
+        /// 先頭を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType begin() const noexcept
+        {
+            return IteratorType(this->m_pData,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+
+        /// 終端を指すイテレータを取得します。
+        /// @return イテレータです。
+        IteratorType end() const noexcept
+        {
+            return IteratorType(this->m_pData + this->m_count,
+                                this->m_pData,
+                                this->m_pData + this->m_count);
+        }
+    };
+
+    /// 文字列の参照のハッシュ関数オブジェクトです。
+    template<>
+    class Hash<StringView>
+    {
+    public:
+        /// 異種型検索に対応していることを示します。
+        using IsTransparent = void;
+
+        /// ハッシュ値を計算します。
+        /// @param value 対象の値です。
+        /// @return ハッシュ値です。
+        USize operator()(StringView value) const noexcept
+        {
+            return (USize) HashBytes(value.Data(), value.Count());
+        }
+    };
+
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 文字列の参照を文字列として書き込みます。
+        template<>
+        struct LogArgument<StringView>
+        {
+            static void Write(Logger &logger, StringView value) noexcept
+            {
+                WriteLogString(logger, value.Data(), value.Count());
+            }
+        };
+    }
+    /// @endcond
+}
+#endif // !_FURAIENGINE_STRINGVIEW_HPP
\ No newline at end of file
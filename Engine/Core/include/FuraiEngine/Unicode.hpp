@@ -0,0 +1,82 @@
+/// @file FuraiEngine/Unicode.hpp
+/// @copyright (C) 2022 FuraiEngineCommunity.
+/// @author Taichi Ito.
+/// UTF-8文字列の検証、変換、検索を提供します。
+/// SSE2、SSSE3、NEONが使用可能な場合はベクトル命令で処理し、それ以外はスカラー処理で同じ結果を返します。
+#ifndef _FURAIENGINE_UNICODE_HPP
+#define _FURAIENGINE_UNICODE_HPP
+#include "FuraiEngine/Utility.hpp"
+/// FuraiEngineのすべての機能を含む名前空間です。
+namespace FuraiEngine
+{
+    /// 文字コード変換に失敗した場合のエラー型です。
+    enum class EUnicodeError : U8
+    {
+        /// 不正なバイト列、または、対になっていないサロゲートが含まれていました。
+        INVALID_SEQUENCE,
+        /// Unicodeの範囲外の値が含まれていました。
+        INVALID_CODE_POINT,
+    };
+
+    /// UTF-8として正しいか検証します。
+    /// 冗長な表現、サロゲート、U+10FFFFを超える値、途切れたバイト列を不正とします。
+    /// @param pText 文字列の先頭です。
+    /// @param count バイト数です。
+    /// @return 正しい場合、真です。
+    Bool IsValidUtf8(const Char *pText, USize count) noexcept;
+
+    /// UTF-8をUTF-16に変換します。
+    /// @param pSource 変換元の先頭です。
+    /// @param count 変換元のバイト数です。
+    /// @param pDestination 変換先です。count要素以上の容量が必要です。
+    /// @return 書き込んだ要素数、または、エラー値です。
+    Result<USize, EUnicodeError> ConvertUtf8ToUtf16(const Char *pSource,
+                                                    USize       count,
+                                                    U16 *pDestination) noexcept;
+
+    /// UTF-8をUTF-32に変換します。
+    /// @param pSource 変換元の先頭です。
+    /// @param count 変換元のバイト数です。
+    /// @param pDestination 変換先です。count要素以上の容量が必要です。
+    /// @return 書き込んだ要素数、または、エラー値です。
+    Result<USize, EUnicodeError> ConvertUtf8ToUtf32(const Char *pSource,
+                                                    USize       count,
+                                                    U32 *pDestination) noexcept;
+
+    /// UTF-16をUTF-8に変換します。
+    /// @param pSource 変換元の先頭です。
+    /// @param count 変換元の要素数です。
+    /// @param pDestination 変換先です。count * 3バイト以上の容量が必要です。
+    /// @return 書き込んだバイト数、または、エラー値です。
+    Result<USize, EUnicodeError> ConvertUtf16ToUtf8(const U16 *pSource,
+                                                    USize      count,
+                                                    Char *pDestination) noexcept;
+
+    /// UTF-32をUTF-8に変換します。
+    /// @param pSource 変換元の先頭です。
+    /// @param count 変換元の要素数です。
+    /// @param pDestination 変換先です。count * 4バイト以上の容量が必要です。
+    /// @return 書き込んだバイト数、または、エラー値です。
+    Result<USize, EUnicodeError> ConvertUtf32ToUtf8(const U32 *pSource,
+                                                    USize      count,
+                                                    Char *pDestination) noexcept;
+
+    /// 部分文字列を検索します。
+    /// @param pText 検索対象の先頭です。
+    /// @param count 検索対象のバイト数です。
+    /// @param pPattern 検索する文字列の先頭です。
+    /// @param patternCount 検索する文字列のバイト数です。
+    /// @return 見つかった位置です。(バイト) 見つからない場合、USIZE_MAXです。
+    USize FindText(const Char *pText,
+                   USize       count,
+                   const Char *pPattern,
+                   USize       patternCount) noexcept;
+
+    /// 文字を検索します。
+    /// @param pText 検索対象の先頭です。UTF-8として正しい必要があります。
+    /// @param count 検索対象のバイト数です。
+    /// @param codePoint 検索する文字のコードポイントです。
+    /// @return 見つかった位置です。(バイト) 見つからない場合、USIZE_MAXです。
+    USize FindCodePoint(const Char *pText, USize count, U32 codePoint) noexcept;
+}
+#endif // !_FURAIENGINE_UNICODE_HPP
\ No newline at end of file
@@ -4,45 +4,472 @@
 /// 有用機能を提供します。
 #ifndef _FURAIENGINE_UTILITY_HPP
 #define _FURAIENGINE_UTILITY_HPP
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include "FuraiEngine/Primitive.hpp"
 /// FuraiEngineのすべての機能を含む名前空間です。
 namespace FuraiEngine
 {
+    /// ログの重要度です。
+    enum class ELogLevel : U8
+    {
+        /// 追跡用の詳細なログです。
+        TRACE = FURAIENGINE_LOG_LEVEL_TRACE,
+        /// 開発用のログです。
+        VERBOSE = FURAIENGINE_LOG_LEVEL_VERBOSE,
+        /// 通常のログです。
+        LOG = FURAIENGINE_LOG_LEVEL_LOG,
+        /// 警告です。
+        WARNING = FURAIENGINE_LOG_LEVEL_WARNING,
+        /// エラーです。
+        ERROR = FURAIENGINE_LOG_LEVEL_ERROR,
+        /// いずれも出力しません。
+        NONE = FURAIENGINE_LOG_LEVEL_NONE,
+    };
+
+    /// コンパイル時に残すログの最小の重要度です。
+    constexpr ELogLevel LOG_LEVEL_MIN = (ELogLevel) FURAIENGINE_LOG_LEVEL;
+
+    /// ログのカテゴリです。
+    /// 実行時にカテゴリごとに出力する最小の重要度を変更できます。
+    /// @warning 静的記憶域期間の変数として定義してください。登録は解除されません。
+    class LogCategory
+    {
+        const Char            *m_pName; // 名前です。
+        std::atomic<ELogLevel> m_level; // 出力する最小の重要度です。
+        LogCategory           *m_pNext; // 登録された次のカテゴリです。
+
+    public:
+        /// 初期化し、登録します。
+        /// @param name 名前です。静的な文字列である必要があります。
+        /// @param level 出力する最小の重要度です。
+        LogCategory(const Char *name,
+                    ELogLevel   level = ELogLevel::TRACE) noexcept;
+
+        LogCategory(const LogCategory &)            = delete;
+        LogCategory &operator=(const LogCategory &) = delete;
+
+        /// 名前を取得します。
+        /// @return 名前です。
+        const Char *Name() const noexcept
+        {
+            return this->m_pName;
+        }
+
+        /// 出力する最小の重要度を取得します。
+        /// @return 出力する最小の重要度です。
+        ELogLevel Level() const noexcept
+        {
+            return this->m_level.load(std::memory_order_relaxed);
+        }
+
+        /// 出力する最小の重要度を設定します。
+        /// @param level 出力する最小の重要度です。
+        void SetLevel(ELogLevel level) noexcept
+        {
+            this->m_level.store(level, std::memory_order_relaxed);
+        }
+
+        /// 重要度のログを出力するか判定します。
+        /// @param level 重要度です。
+        /// @return 出力する場合、真です。
+        Bool IsEnabled(ELogLevel level) const noexcept
+        {
+            return level >= this->m_level.load(std::memory_order_relaxed);
+        }
+
+        friend Bool SetLogLevel(const Char *name, ELogLevel level) noexcept;
+    };
+
+    /// 既定のログカテゴリを取得します。
+    /// カテゴリを指定しないLog、LogWarning、LogErrorはこのカテゴリで出力します。
+    /// @return 既定のログカテゴリです。
+    LogCategory &DefaultLogCategory() noexcept;
+
+    /// 名前が一致するカテゴリの出力する最小の重要度を設定します。
+    /// @param name カテゴリの名前です。
+    /// @param level 出力する最小の重要度です。
+    /// @return カテゴリが見つかった場合、真です。
+    Bool SetLogLevel(const Char *name, ELogLevel level) noexcept;
+
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 破棄した回数が残っているログの出力制限について、回数を出力します。
+        /// 書き込みスレッドが記録を読み込む前に呼び出します。
+        /// @param isFlushing 書き込みが要求されている場合、秒が変わる前でも出力します。
+        void FlushLogRateLimiters(Bool isFlushing) noexcept;
+    }
+    /// @endcond
+
+    /// ログの出力回数を1秒ごとに制限します。
+    /// 呼び出し箇所ごとに静的記憶域期間の変数として定義します。通常はFURAIENGINE_LOG_RATE_LIMITEDを使用してください。
+    /// 破棄した回数は、次の出力の前、秒が変わった時、または、書き込みの要求時に出力します。
+    /// @warning 初めて破棄した時に書き込みスレッドへ登録され、登録は解除されません。静的記憶域期間以外で定義しないでください。
+    class LogRateLimiter
+    {
+        U32                              m_countPerSecond;  // 1秒あたりに出力する最大の回数です。
+        std::atomic<U64>                 m_second;          // 現在数えている秒です。
+        std::atomic<U32>                 m_count;           // 現在の秒に出力を試みた回数です。
+        std::atomic<U64>                 m_suppressedCount; // 最後に出力してから破棄した回数です。
+        std::atomic<ELogLevel>           m_level;           // 破棄した回数を出力する重要度です。
+        std::atomic<const LogCategory *> m_pCategory;       // 破棄した回数を出力するカテゴリです。
+        std::atomic<Bool>                m_isRegisteredF;   // 書き込みスレッドに登録済みか判定します。
+        LogRateLimiter                  *m_pNext;           // 登録された次の制限です。登録後は変更されません。
+
+        friend void _Internal::FlushLogRateLimiters(Bool isFlushing) noexcept;
+
+    public:
+        /// 初期化します。
+        /// @param countPerSecond 1秒あたりに出力する最大の回数です。
+        constexpr LogRateLimiter(U32 countPerSecond) noexcept
+            : m_countPerSecond(countPerSecond)
+            , m_second(0)
+            , m_count(0)
+            , m_suppressedCount(0)
+            , m_level(ELogLevel::LOG)
+            , m_pCategory(nullptr)
+            , m_isRegisteredF(false)
+            , m_pNext(nullptr)
+        {}
+
+        LogRateLimiter(const LogRateLimiter &)            = delete;
+        LogRateLimiter &operator=(const LogRateLimiter &) = delete;
+
+        /// 出力できるか判定します。
+        /// 破棄した出力がある場合、出力を再開する前に破棄した回数を出力します。
+        /// @param level 破棄した回数を出力する重要度です。
+        /// @param category 破棄した回数を出力するカテゴリです。
+        /// @return 出力できる場合、真です。
+        Bool TryAcquire(ELogLevel level, const LogCategory &category) noexcept;
+    };
+
     /// @cond FURAIDOC_INTERNAL
     /// 非公開機能を含む名前空間です。
     namespace _Internal
     {
+        /// 追跡用ラベルです。
+        constexpr const Char *TRACE_LABEL = TXT("TRACE");
+
+        /// 開発用ラベルです。
+        constexpr const Char *VERBOSE_LABEL = TXT("VERBOSE");
+
         /// ログ用ラベルです。
-        static const Char *LOG_LABEL = TXT("LOG");
+        constexpr const Char *LOG_LABEL = TXT("LOG");
 
         /// 警告用ラベルです。
-        static const Char *WARNING_LABEL = TXT("WARNING");
+        constexpr const Char *WARNING_LABEL = TXT("WARNING");
 
         /// エラー用ラベルです。
-        static const Char *ERROR_LABEL = TXT("ERROR");
+        constexpr const Char *ERROR_LABEL = TXT("ERROR");
+
+        /// 重要度のラベルを取得します。
+        /// @param level 重要度です。
+        /// @return ラベルです。
+        constexpr const Char *LabelOf(ELogLevel level) noexcept
+        {
+            switch (level)
+            {
+            case ELogLevel::TRACE:
+                return TRACE_LABEL;
+            case ELogLevel::VERBOSE:
+                return VERBOSE_LABEL;
+            case ELogLevel::LOG:
+                return LOG_LABEL;
+            case ELogLevel::WARNING:
+                return WARNING_LABEL;
+            default:
+                return ERROR_LABEL;
+            }
+        }
+
+        class LogBuffer;
+
+        /// 遅延書式化する引数の種類です。
+        /// 記録には種類の1バイトに続けて値を書き込みます。
+        enum class ELogArgument : U8
+        {
+            /// 真偽値です。(U8)
+            BOOL,
+            /// 符号付き整数です。(I64)
+            SIGNED,
+            /// 符号無し整数です。(U64)
+            UNSIGNED,
+            /// 浮動小数点数です。(F64)
+            FLOAT,
+            /// 文字です。(U8)
+            CHAR,
+            /// 文字列です。(U32の長さと文字の並び)
+            STRING,
+            /// ポインタです。(USize)
+            POINTER,
+        };
+
+        /// 記録に書き込む文字列引数の最大の長さです。超えた分は切り詰めます。
+        constexpr USize LOG_STRING_ARGUMENT_MAX = 4096;
 
         /// ロガーです。
+        /// メッセージは呼び出したスレッドのバッファへ書き込まれ、
+        /// 書き込みスレッドがまとめて出力先へ出力します。
+        /// 記録には単調増加する時計の時間を付け、出力時にのみローカル時間へ変換します。
+        /// 書き込みスレッドは各スレッドの記録を時間の順に併合して出力します。
         class Logger
         {
+            LogBuffer *m_pBuffer; // 書き込み先のバッファです。
+            USize      m_begin;   // 記録の開始位置です。
+            USize      m_end;     // 記録の終了位置です。
+
+            // 記録を破棄します。
+            void _Discard() noexcept;
+
         public:
             /// 初期化します。
             /// @param label メッセージのカテゴリラベルです。
-            /// @warning 同スレッド内でインスタンス解放前にもう1つインスタンス化するとデッドロックが発生します。
-            Logger(const Char *label) noexcept;
+            /// @param format 書式です。nullptrの場合、メッセージをそのまま出力します。
+            /// @param pCategory カテゴリです。nullptrの場合、既定のカテゴリです。
+            /// @warning 同スレッド内でインスタンス解放前にもう1つインスタンス化した場合、後のインスタンスの記録は破棄されます。
+            /// @warning formatは静的な文字列である必要があります。書式化は書き込みスレッドで行います。
+            Logger(const Char        *label,
+                   const Char        *format    = nullptr,
+                   const LogCategory *pCategory = nullptr) noexcept;
 
             /// ムーブします。
             /// @param origin ムーブ元です。
             Logger(Logger &&origin) noexcept;
 
             /// 解体します。
+            /// 記録を確定し、書き込みスレッドへ渡します。
             ~Logger() noexcept;
 
             /// メッセージを追加します。
             /// @param message メッセージです。
             /// @return 自身のインスタンスです。
             Logger &&Write(const Char *message) noexcept;
+
+            /// 書式化する引数を追加します。
+            /// 記録に収まらない場合、引数は破棄されます。
+            /// @param type 引数の種類です。
+            /// @param pValue 値です。
+            /// @param size 値のサイズです。
+            /// @return 自身のインスタンスです。
+            Logger &&WriteArgument(ELogArgument type,
+                                   const void  *pValue,
+                                   USize        size) noexcept;
+        };
+
+        /// 書式化する引数を記録へ書き込みます。
+        /// 対応しない型の場合、コンパイルエラーになります。
+        /// 他のヘッダーで定義する型は、そのヘッダーで特殊化します。
+        /// @tparam T 引数の型です。
+        template<typename T, typename = void>
+        struct LogArgument;
+
+        /// 文字列引数を長さと文字の並びで記録へ書き込みます。
+        /// LOG_STRING_ARGUMENT_MAXを超えた分は切り詰めます。
+        /// @param logger 書き込むロガーです。
+        /// @param pData 文字の並びです。
+        /// @param count 文字数です。
+        inline void
+        WriteLogString(Logger &logger, const void *pData, USize count) noexcept
+        {
+            logger.WriteArgument(ELogArgument::STRING,
+                                 pData,
+                                 count < LOG_STRING_ARGUMENT_MAX
+                                     ? count
+                                     : LOG_STRING_ARGUMENT_MAX);
+        }
+
+        /// 文字型か判定します。
+        /// @tparam T 判定する型です。
+        template<typename T>
+        constexpr Bool IS_LOG_CHAR =
+            std::is_same<T, char>::value || std::is_same<T, Char>::value;
+
+        /// 真偽値を書き込みます。
+        template<>
+        struct LogArgument<Bool>
+        {
+            static void Write(Logger &logger, Bool value) noexcept
+            {
+                U8 byte = value ? 1 : 0;
+                logger.WriteArgument(ELogArgument::BOOL, &byte, sizeof(byte));
+            }
+        };
+
+        /// 文字を書き込みます。
+        template<typename T>
+        struct LogArgument<T, std::enable_if_t<IS_LOG_CHAR<T>>>
+        {
+            static void Write(Logger &logger, T value) noexcept
+            {
+                logger.WriteArgument(ELogArgument::CHAR, &value, sizeof(value));
+            }
+        };
+
+        /// 整数を書き込みます。
+        template<typename T>
+        struct LogArgument<T,
+                           std::enable_if_t<std::is_integral<T>::value
+                                            && !std::is_same<T, Bool>::value
+                                            && !IS_LOG_CHAR<T>>>
+        {
+            static void Write(Logger &logger, T value) noexcept
+            {
+                if (std::is_signed<T>::value)
+                {
+                    auto integer = (I64) value;
+                    logger.WriteArgument(
+                        ELogArgument::SIGNED, &integer, sizeof(integer));
+                }
+                else
+                {
+                    auto integer = (U64) value;
+                    logger.WriteArgument(
+                        ELogArgument::UNSIGNED, &integer, sizeof(integer));
+                }
+            }
+        };
+
+        /// 列挙値を基底の整数として書き込みます。
+        template<typename T>
+        struct LogArgument<T, std::enable_if_t<std::is_enum<T>::value>>
+        {
+            static void Write(Logger &logger, T value) noexcept
+            {
+                using UnderlyingType = std::underlying_type_t<T>;
+                LogArgument<UnderlyingType>::Write(logger,
+                                                   (UnderlyingType) value);
+            }
         };
+
+        /// 浮動小数点数を書き込みます。
+        template<typename T>
+        struct LogArgument<T, std::enable_if_t<std::is_floating_point<T>::value>>
+        {
+            static void Write(Logger &logger, T value) noexcept
+            {
+                auto real = (F64) value;
+                logger.WriteArgument(ELogArgument::FLOAT, &real, sizeof(real));
+            }
+        };
+
+        /// ポインタを書き込みます。文字のポインタは文字列として書き込みます。
+        template<typename T>
+        struct LogArgument<T *>
+        {
+            static void Write(Logger &logger, const T *value) noexcept
+            {
+                if (IS_LOG_CHAR<std::remove_cv_t<T>> && value != nullptr)
+                    WriteLogString(logger,
+                                   value,
+                                   std::strlen((const char *) value));
+                else
+                {
+                    auto address = (USize) value;
+                    logger.WriteArgument(
+                        ELogArgument::POINTER, &address, sizeof(address));
+                }
+            }
+        };
+
+        /// 文字の配列を文字列として書き込みます。
+        template<typename T, USize N>
+        struct LogArgument<T[N], std::enable_if_t<IS_LOG_CHAR<T>>>
+        {
+            static void Write(Logger &logger, const T (&value)[N]) noexcept
+            {
+                LogArgument<const T *>::Write(logger, value);
+            }
+        };
+
+        /// 型をそのまま返し、テンプレート引数の推論を止めます。
+        /// @tparam T 型です。
+        template<typename T>
+        struct TypeIdentity
+        {
+            /// 型です。
+            using Type = T;
+        };
+
+        /// 書式の'{}'の数を数えます。
+        /// @param format 書式です。
+        /// @return '{}'の数です。書式が不正な場合、USIZE_MAXです。
+        constexpr USize CountLogPlaceholders(const Char *format) noexcept
+        {
+            USize count = 0;
+            for (; *format != '\0'; format++)
+            {
+                if (format[0] == '{' && format[1] == '}')
+                    count++;
+                else if (!(format[0] == '{' && format[1] == '{')
+                         && !(format[0] == '}' && format[1] == '}'))
+                {
+                    if (format[0] == '{' || format[0] == '}')
+                        return USIZE_MAX;
+                    continue;
+                }
+                format++;
+            }
+            return count;
+        }
+
+        /// 書式の誤りを出力し、異常終了します。
+        /// 定数式の評価中に呼び出された場合、コンパイルエラーになります。
+        /// @param format 書式です。
+        [[noreturn]] void ExitInvalidLogFormat(const Char *format) noexcept;
+
+        /// 引数との対応を検査した書式です。
+        /// C++20以降はコンパイル時に検査します。
+        /// C++17では、NDEBUGが定義されていない場合に実行時に検査します。
+        /// @tparam Args 引数の型です。
+        template<typename... Args>
+        class LogFormat
+        {
+            const Char *m_pFormat; // 書式です。
+
+        public:
+            /// 書式の文字列リテラルで初期化します。
+            /// @param format 書式です。'{}'の数が引数の数と一致する必要があります。
+            template<USize N>
+            FURAIENGINE_CONSTEVAL LogFormat(const Char (&format)[N]) noexcept
+                : m_pFormat(format)
+            {
+#if __cplusplus >= 202002L || !defined(NDEBUG)
+                if (CountLogPlaceholders(format) != sizeof...(Args))
+                    ExitInvalidLogFormat(format);
+#endif
+            }
+
+            /// 書式を取得します。
+            /// @return 書式です。
+            constexpr const Char *Get() const noexcept
+            {
+                return this->m_pFormat;
+            }
+        };
+
+        /// 書式化したログを出力します。
+        /// カテゴリによる絞り込みは呼び出し元で行います。
+        /// @tparam Args 引数の型です。
+        /// @param level 重要度です。
+        /// @param category カテゴリです。
+        /// @param format 書式です。
+        /// @param args 引数です。
+        template<typename... Args>
+        void LogFormatted(ELogLevel                 level,
+                          const LogCategory        &category,
+                          const LogFormat<Args...> &format,
+                          const Args &...args) noexcept
+        {
+            Logger logger(LabelOf(level), format.Get(), &category);
+            (LogArgument<Args>::Write(logger, args), ...);
+        }
     }
     /// @endcode
 
@@ -51,7 +478,7 @@ namespace FuraiEngine
     template<typename T>
     const Char *TypenameOf() noexcept
     {
-        return typeid(T).name();
+        return (const Char *) typeid(T).name();
     }
 
     /// ログを出力します。
@@ -66,6 +493,89 @@ namespace FuraiEngine
     /// @param message 出力メッセージです。
     void LogError(const Char *message) noexcept;
 
+    /// ログを書式化して出力します。
+    /// 呼び出し元は書式と引数を記録へ複写するのみで、書式化は書き込みスレッドで行います。
+    /// @tparam Args 引数の型です。対応しない型の場合、コンパイルエラーになります。
+    /// @param format 書式の文字列リテラルです。'{}'を順に引数で置き換えます。'{{'、'}}'は'{'、'}'を出力します。
+    /// @param args 引数です。'{}'と同じ数が必要です。
+    template<typename... Args>
+    void Log(
+        _Internal::LogFormat<typename _Internal::TypeIdentity<Args>::Type...> format,
+        const Args &...args) noexcept
+    {
+        if constexpr (ELogLevel::LOG >= LOG_LEVEL_MIN)
+        {
+            auto &category = DefaultLogCategory();
+            if (category.IsEnabled(ELogLevel::LOG))
+                _Internal::LogFormatted<Args...>(
+                    ELogLevel::LOG, category, format, args...);
+        }
+    }
+
+    /// 警告を書式化して出力します。
+    /// 呼び出し元は書式と引数を記録へ複写するのみで、書式化は書き込みスレッドで行います。
+    /// @tparam Args 引数の型です。対応しない型の場合、コンパイルエラーになります。
+    /// @param format 書式の文字列リテラルです。'{}'を順に引数で置き換えます。'{{'、'}}'は'{'、'}'を出力します。
+    /// @param args 引数です。'{}'と同じ数が必要です。
+    template<typename... Args>
+    void LogWarning(
+        _Internal::LogFormat<typename _Internal::TypeIdentity<Args>::Type...> format,
+        const Args &...args) noexcept
+    {
+        if constexpr (ELogLevel::WARNING >= LOG_LEVEL_MIN)
+        {
+            auto &category = DefaultLogCategory();
+            if (category.IsEnabled(ELogLevel::WARNING))
+                _Internal::LogFormatted<Args...>(
+                    ELogLevel::WARNING, category, format, args...);
+        }
+    }
+
+    /// エラーを書式化して出力します。
+    /// 呼び出し元は書式と引数を記録へ複写するのみで、書式化は書き込みスレッドで行います。
+    /// @tparam Args 引数の型です。対応しない型の場合、コンパイルエラーになります。
+    /// @param format 書式の文字列リテラルです。'{}'を順に引数で置き換えます。'{{'、'}}'は'{'、'}'を出力します。
+    /// @param args 引数です。'{}'と同じ数が必要です。
+    template<typename... Args>
+    void LogError(
+        _Internal::LogFormat<typename _Internal::TypeIdentity<Args>::Type...> format,
+        const Args &...args) noexcept
+    {
+        if constexpr (ELogLevel::ERROR >= LOG_LEVEL_MIN)
+        {
+            auto &category = DefaultLogCategory();
+            if (category.IsEnabled(ELogLevel::ERROR))
+                _Internal::LogFormatted<Args...>(
+                    ELogLevel::ERROR, category, format, args...);
+        }
+    }
+
+    /// 出力済みのログがファイルへ書き込まれるまで待機します。
+    void FlushLog() noexcept;
+
+    /// 各スレッドの最新のログの記録を出力先へ出力します。
+    /// 記録は既に出力したものも含め、スレッドごとに最大64件です。
+    /// 致命的なシグナルの受信時は標準エラー出力へ自動で出力されます。
+    void DumpLogFlightRecorder() noexcept;
+
+    /// 重要度とカテゴリを指定してログを書式化して出力します。
+    /// @tparam Args 引数の型です。対応しない型の場合、コンパイルエラーになります。
+    /// @param level 重要度です。
+    /// @param category カテゴリです。
+    /// @param format 書式の文字列リテラルです。'{}'を順に引数で置き換えます。'{{'、'}}'は'{'、'}'を出力します。
+    /// @param args 引数です。'{}'と同じ数が必要です。
+    /// @note 引数の評価を含めて取り除くには、FURAIENGINE_LOGを使用してください。
+    template<typename... Args>
+    void LogAt(
+        ELogLevel                                                              level,
+        const LogCategory                                                     &category,
+        _Internal::LogFormat<typename _Internal::TypeIdentity<Args>::Type...> format,
+        const Args &...args) noexcept
+    {
+        if (level >= LOG_LEVEL_MIN && category.IsEnabled(level))
+            _Internal::LogFormatted<Args...>(level, category, format, args...);
+    }
+
     /// 正常終了します。
     [[noreturn]] inline void Exit() noexcept
     {
@@ -73,10 +583,9 @@ namespace FuraiEngine
     }
 
     /// 異常終了します。
-    [[noreturn]] inline void ExitError() noexcept
-    {
-        std::exit(-1);
-    }
+    /// 記録済みのログは終了時に出力先へ書き込まれます。
+    /// 出力先への書き込み中に呼び出した場合、書き込まれていない記録を標準エラー出力へ出力します。
+    [[noreturn]] void ExitError() noexcept;
 
     /// 異常終了します。
     /// @param message 出力メッセージです。
@@ -86,6 +595,98 @@ namespace FuraiEngine
         ExitError();
     }
 
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// 範囲外へのアクセスを出力し、異常終了します。
+        /// @param index アクセスした位置です。
+        /// @param count 要素数です。
+        /// @param signature アクセスした関数のシグネチャです。
+        [[noreturn]] void ExitOutOfRange(USize       index,
+                                         USize       count,
+                                         const Char *signature) noexcept;
+
+        /// 範囲外の部分領域の参照を出力し、異常終了します。
+        /// @param offset 部分領域の先頭の位置です。
+        /// @param count 部分領域の要素数です。
+        /// @param size 全体の要素数です。
+        /// @param signature 参照した関数のシグネチャです。
+        [[noreturn]] void ExitOutOfRange(USize       offset,
+                                         USize       count,
+                                         USize       size,
+                                         const Char *signature) noexcept;
+
+        /// ヌルへのアクセスを出力し、異常終了します。
+        /// @param signature アクセスした関数のシグネチャです。
+        [[noreturn]] void ExitNullAccess(const Char *signature) noexcept;
+
+        /// 位置が範囲内か検査します。
+        /// FURAIENGINE_BOUNDS_CHECKがFURAIENGINE_BOUNDS_CHECK_NONEの場合、何もしません。
+        /// @param index アクセスする位置です。
+        /// @param count 要素数です。
+        /// @param signature アクセスする関数のシグネチャです。
+        constexpr void CheckIndex([[maybe_unused]] USize       index,
+                                  [[maybe_unused]] USize       count,
+                                  [[maybe_unused]] const Char *signature) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_FULL
+            if (index >= count)
+                ExitOutOfRange(index, count, signature);
+#elif FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_ASSERT
+            if (index >= count)
+                ExitError();
+#endif
+        }
+
+        /// 部分領域が範囲内か検査します。
+        /// FURAIENGINE_BOUNDS_CHECKがFURAIENGINE_BOUNDS_CHECK_NONEの場合、何もしません。
+        /// @param offset 部分領域の先頭の位置です。
+        /// @param count 部分領域の要素数です。
+        /// @param size 全体の要素数です。
+        /// @param signature 参照する関数のシグネチャです。
+        constexpr void CheckRange([[maybe_unused]] USize       offset,
+                                  [[maybe_unused]] USize       count,
+                                  [[maybe_unused]] USize       size,
+                                  [[maybe_unused]] const Char *signature) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_FULL
+            if (offset > size || count > size - offset)
+                ExitOutOfRange(offset, count, size, signature);
+#elif FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_ASSERT
+            if (offset > size || count > size - offset)
+                ExitError();
+#endif
+        }
+
+        /// 要素のポインタが範囲内か検査します。
+        /// FURAIENGINE_BOUNDS_CHECKがFURAIENGINE_BOUNDS_CHECK_NONEの場合、何もしません。
+        /// @param pElement アクセスする要素です。
+        /// @param pBegin 範囲の先頭です。nullptrの場合、ヌルのみを検査します。
+        /// @param pEnd 範囲の終端です。
+        /// @param signature アクセスする関数のシグネチャです。
+        template<typename T>
+        void CheckElement([[maybe_unused]] const T    *pElement,
+                          [[maybe_unused]] const T    *pBegin,
+                          [[maybe_unused]] const T    *pEnd,
+                          [[maybe_unused]] const Char *signature) noexcept
+        {
+#if FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_FULL
+            if (pElement == nullptr)
+                ExitNullAccess(signature);
+            if (pBegin != nullptr && (pElement < pBegin || pElement >= pEnd))
+                ExitOutOfRange((USize) (pElement - pBegin),
+                               (USize) (pEnd - pBegin),
+                               signature);
+#elif FURAIENGINE_BOUNDS_CHECK == FURAIENGINE_BOUNDS_CHECK_ASSERT
+            if (pElement == nullptr
+                || (pBegin != nullptr && (pElement < pBegin || pElement >= pEnd)))
+                ExitError();
+#endif
+        }
+    }
+    /// @endcond
+
     /// ムーブします。
     /// @tparam T ムーブする型です。
     /// @param value ムーブする値です。
@@ -105,7 +706,7 @@ namespace FuraiEngine
     constexpr T &&
     Forward(typename std::remove_reference<T>::type &value) noexcept
     {
-        return std::forward(value);
+        return std::forward<T>(value);
     }
 
     /// 左辺値はコピー、右辺値はムーブします。
@@ -116,90 +717,332 @@ namespace FuraiEngine
     constexpr T &&
     Forward(typename std::remove_reference<T>::type &&value) noexcept
     {
-        return std::forward(value);
+        return std::forward<T>(value);
     }
 
+    /// @cond FURAIDOC_INTERNAL
+    /// 非公開機能を含む名前空間です。
+    namespace _Internal
+    {
+        /// Resultの値の配置です。
+        enum class EResultLayout : U8
+        {
+            NICHE,   ///< 失敗値を成功値のポインタの使用されない値に格納します。
+            TRIVIAL, ///< トリビアルにコピー可能な共用体と判別値で格納します。
+            GENERAL  ///< 共用体と判別値で格納し、ムーブ元を空にします。
+        };
+
+        /// Resultの値の配置を判定します。
+        /// 成功値がポインタで失敗値が1バイトの列挙型、または、整数型の場合、NICHEです。
+        /// 成功値と失敗値が共にトリビアルにコピー可能な場合、TRIVIALです。
+        /// @tparam S 成功時の型です。
+        /// @tparam F 失敗時の型です。
+        template<typename S, typename F>
+        constexpr EResultLayout RESULT_LAYOUT_OF =
+            std::is_pointer<S>::value
+                    && (std::is_enum<F>::value || std::is_integral<F>::value)
+                    && sizeof(F) == 1
+                ? EResultLayout::NICHE
+            : std::is_trivially_copyable<S>::value
+                    && std::is_trivially_copyable<F>::value
+                ? EResultLayout::TRIVIAL
+                : EResultLayout::GENERAL;
+
+        /// Resultの値を格納します。
+        /// @tparam S 成功時の型です。
+        /// @tparam F 失敗時の型です。
+        /// @tparam LAYOUT 値の配置です。
+        template<typename S,
+                 typename F,
+                 EResultLayout LAYOUT = RESULT_LAYOUT_OF<S, F>>
+        class ResultStorage;
+
+        /// 失敗値を成功値のポインタの使用されない値に格納します。
+        /// 失敗値は先頭の1から256のアドレスとして格納します。
+        /// OSはこの範囲を確保しないため、有効なポインタと区別できます。
+        /// @tparam S 成功時の型です。
+        /// @tparam F 失敗時の型です。
+        template<typename S, typename F>
+        class ResultStorage<S, F, EResultLayout::NICHE>
+        {
+            static constexpr USize FAILURS_COUNT = 256; // 失敗値の数です。
+
+            S m_value; // 成功値、または、失敗値を格納したポインタです。
+
+        public:
+            /// 成功値で初期化します。
+            /// @param value 成功値です。
+            ResultStorage(S value) noexcept
+                : m_value(value)
+            {}
+
+            /// 失敗値で初期化します。
+            /// @param value 失敗値です。
+            ResultStorage(F value) noexcept
+                : m_value(reinterpret_cast<S>((USize) (U8) value + 1))
+            {}
+
+            /// 成功か判定します。
+            /// @return 成功判定値です。
+            Bool IsSuccess() const noexcept
+            {
+                return reinterpret_cast<USize>(this->m_value) - 1 >= FAILURS_COUNT;
+            }
+
+            /// 失敗か判定します。
+            /// @return 失敗判定値です。
+            Bool IsFailur() const noexcept
+            {
+                return !this->IsSuccess();
+            }
+
+            /// 成功値を取り出します。
+            /// @return 成功値です。
+            S &&TakeSuccess() noexcept
+            {
+                return Move(this->m_value);
+            }
+
+            /// 失敗値を取り出します。
+            /// @return 失敗値です。
+            F TakeFailur() noexcept
+            {
+                return (F) (U8) (reinterpret_cast<USize>(this->m_value) - 1);
+            }
+        };
+
+        /// トリビアルにコピー可能な共用体と判別値で格納します。
+        /// @tparam S 成功時の型です。
+        /// @tparam F 失敗時の型です。
+        template<typename S, typename F>
+        class ResultStorage<S, F, EResultLayout::TRIVIAL>
+        {
+            union UValue
+            {
+                S m_success; // 成功時の値です。
+                F m_failur;  // 失敗時の値です。
+
+                /// 成功値で初期化します。
+                UValue(S &&value) noexcept
+                    : m_success(Move(value))
+                {}
+
+                /// 失敗値で初期化します。
+                UValue(F &&value) noexcept
+                    : m_failur(Move(value))
+                {}
+            } m_value;        // 値です。
+            Bool m_isSuccess; // 成功か判定します。
+
+        public:
+            /// 成功値で初期化します。
+            /// @param value 成功値です。
+            ResultStorage(S &&value) noexcept
+                : m_value(Move(value)), m_isSuccess(true)
+            {}
+
+            /// 失敗値で初期化します。
+            /// @param value 失敗値です。
+            ResultStorage(F &&value) noexcept
+                : m_value(Move(value)), m_isSuccess(false)
+            {}
+
+            /// 成功か判定します。
+            /// @return 成功判定値です。
+            Bool IsSuccess() const noexcept
+            {
+                return this->m_isSuccess;
+            }
+
+            /// 失敗か判定します。
+            /// @return 失敗判定値です。
+            Bool IsFailur() const noexcept
+            {
+                return !this->m_isSuccess;
+            }
+
+            /// 成功値を取り出します。
+            /// @return 成功値です。
+            S &&TakeSuccess() noexcept
+            {
+                return Move(this->m_value.m_success);
+            }
+
+            /// 失敗値を取り出します。
+            /// @return 失敗値です。
+            F &&TakeFailur() noexcept
+            {
+                return Move(this->m_value.m_failur);
+            }
+        };
+
+        /// 共用体と判別値で格納します。
+        /// ムーブ元は値を解体し、空になります。
+        /// @tparam S 成功時の型です。
+        /// @tparam F 失敗時の型です。
+        template<typename S, typename F>
+        class ResultStorage<S, F, EResultLayout::GENERAL>
+        {
+            union UValue
+            {
+                U8 m_ready;  // 初期化を遅延させるための、ダミー値です。
+                S m_success; // 成功時の値です。
+                F m_failur;  // 失敗時の値です。
+
+                /// ダミー値で初期化します。
+                UValue() noexcept
+                    : m_ready(0)
+                {}
+
+                /// 解体します。値の解体はResultStorageが行います。
+                ~UValue() noexcept
+                {}
+            } m_value;
+            enum class EState : U8
+            {
+                READY,   // 値はダミー値です。
+                SUCCESS, // 値は成功値です。
+                FAILUR   // 値は失敗値です。
+            } m_state;   // 値の判別値です。
+
+            /// 値を解体し、空にします。
+            void _Destroy() noexcept
+            {
+                if (this->m_state == EState::SUCCESS)
+                    this->m_value.m_success.~S();
+                else if (this->m_state == EState::FAILUR)
+                    this->m_value.m_failur.~F();
+                this->m_state = EState::READY;
+            }
+
+            /// ムーブ元の値で初期化し、ムーブ元を空にします。
+            /// @param origin ムーブ元です。
+            void _MoveFrom(ResultStorage &origin) noexcept
+            {
+                if (origin.m_state == EState::SUCCESS)
+                    new (&this->m_value.m_success) S(Move(origin.m_value.m_success));
+                else if (origin.m_state == EState::FAILUR)
+                    new (&this->m_value.m_failur) F(Move(origin.m_value.m_failur));
+                this->m_state = origin.m_state;
+                origin._Destroy();
+            }
+
+        public:
+            /// 成功値で初期化します。
+            /// @param value 成功値です。
+            ResultStorage(S &&value) noexcept
+                : m_value(), m_state(EState::SUCCESS)
+            {
+                new (&this->m_value.m_success) S(Move(value));
+            }
+
+            /// 失敗値で初期化します。
+            /// @param value 失敗値です。
+            ResultStorage(F &&value) noexcept
+                : m_value(), m_state(EState::FAILUR)
+            {
+                new (&this->m_value.m_failur) F(Move(value));
+            }
+
+            /// ムーブします。
+            /// @param origin ムーブ元です。
+            ResultStorage(ResultStorage &&origin) noexcept
+                : m_value(), m_state(EState::READY)
+            {
+                this->_MoveFrom(origin);
+            }
+
+            /// ムーブ代入します。
+            /// @param origin ムーブ元です。
+            /// @return 自身のインスタンスです。
+            ResultStorage &operator=(ResultStorage &&origin) noexcept
+            {
+                if (this != &origin)
+                {
+                    this->_Destroy();
+                    this->_MoveFrom(origin);
+                }
+                return *this;
+            }
+
+            /// 解体します。
+            ~ResultStorage() noexcept
+            {
+                this->_Destroy();
+            }
+
+            /// 成功か判定します。
+            /// @return 成功判定値です。
+            Bool IsSuccess() const noexcept
+            {
+                return this->m_state == EState::SUCCESS;
+            }
+
+            /// 失敗か判定します。
+            /// @return 失敗判定値です。
+            Bool IsFailur() const noexcept
+            {
+                return this->m_state == EState::FAILUR;
+            }
+
+            /// 成功値を取り出します。
+            /// @return 成功値です。
+            S &&TakeSuccess() noexcept
+            {
+                return Move(this->m_value.m_success);
+            }
+
+            /// 失敗値を取り出します。
+            /// @return 失敗値です。
+            F &&TakeFailur() noexcept
+            {
+                return Move(this->m_value.m_failur);
+            }
+        };
+    }
+    /// @endcond
+
     /// 戻り値の成功、または、失敗を表現します。
+    /// 成功値と失敗値が共にトリビアルにコピー可能な場合、トリビアルにコピー可能です。この場合、ムーブ元は値を保持します。
+    /// 成功値がポインタで失敗値が1バイトの列挙型、または、整数型の場合、ポインタと同じ大きさです。
     /// @tparam S 成功時の型です。
     /// @tparam F 失敗時の型です。
+    /// @warning 成功値がポインタで失敗値が1バイトの列挙型、または、整数型の場合、
+    ///          成功値に1から256のアドレスは使用できません。
     template<typename S, typename F>
-    class Result
+    class [[nodiscard]] Result
     {
+        _Internal::ResultStorage<S, F> m_storage; // 値です。
 
-        union UValue
+        /// 移動された値へのアクセスを出力し、異常終了します。
+        /// @param signature アクセスした関数のシグネチャです。
+        [[noreturn]] void _ExitMovedAccess(const Char *signature) noexcept
         {
-            U8 m_ready; // 初期化を遅延させるための、ダミー値です。
-            S m_success; // 成功時の値です。
-            F m_failur;  // 失敗時の値です。
-            /// ダミー値で初期化します。
-            UValue(): m_ready(0)
-            {}
-        } m_value;
-        enum class EState : U8
-        {
-            READY,   // 値はダミー値です。
-            SUCCESS, // 値は成功値です。
-            FAILUR   // 値は失敗値です。
-        } m_state;   // 値の判別値です。
+            LogError(TXT("移動された値にアクセスしようとしました。'Result<{}, {}>::{}'"),
+                     TypenameOf<S>(),
+                     TypenameOf<F>(),
+                     signature);
+            ExitError();
+        }
 
     public:
         /// 成功値で初期化します。
         /// @param value 成功値です。
         Result(S &&value) noexcept
-            : m_value(), m_state(EState::SUCCESS)
-        {
-            this->m_value.m_success = Move(value);
-        }
+            : m_storage(Move(value))
+        {}
 
         /// 失敗値で初期化します。
         /// @param value 失敗値です。
         Result(F &&value) noexcept
-            : m_value(), m_state(EState::FAILUR)
-        {
-            this->m_value.m_failur = Move(value);
-        }
-
-        /// ムーブ代入します。
-        /// @param origin ムーブ元です。
-        /// @return 自身のインスタンスです。
-        Result<S, F> &operator=(Result<S, F> &&origin) noexcept
-        {
-            if (this != &origin)
-            {
-                auto rrTmpState = Move(this->m_state);
-                auto rrTmpValue = Move(this->m_value);
-                this->m_state   = Move(origin.m_state);
-                this->m_value   = Move(origin.m_value);
-                origin.m_state  = Move(rrTmpState);
-                origin.m_value  = Move(rrTmpValue);
-            }
-            return *this;
-        }
-
-        /// ムーブします。
-        /// @param origin ムーブ元です。
-        Result(Result<S, F> &&origin) noexcept
-            : m_value(), m_state(EState::READY)
-        {
-            *this = Move(origin);
-        }
-
-        /// 終了化します。
-        ~Result()
-        {
-            // デストラクタを有する場合に、
-            // 安全にデストラクタを呼びたい
-            if (this->m_state == EState::SUCCESS) [[maybe_unused]]
-                S _tmp = Move(this->m_value.m_success);
-            else if (this->m_state == EState::FAILUR) [[maybe_unused]]
-                F _tmp = Move(this->m_value.m_failur);
-        }
+            : m_storage(Move(value))
+        {}
 
         /// 成功か判定します。
         /// @return 成功判定値です。
         Bool IsSuccess() noexcept
         {
-            return this->m_state == EState::SUCCESS;
+            return this->m_storage.IsSuccess();
         }
 
         /// 成功か判定します。
@@ -209,7 +1052,7 @@ namespace FuraiEngine
         {
             if (this->IsSuccess())
             {
-                value = Move(this->m_value.m_success);
+                value = this->m_storage.TakeSuccess();
                 return true;
             }
             return false;
@@ -224,38 +1067,23 @@ namespace FuraiEngine
         {
             if (this->IsSuccess())
             {
-                success = Move(this->m_value.m_success);
+                success = this->m_storage.TakeSuccess();
                 return true;
             }
             else if (this->IsFailur())
             {
-                failur = Move(this->m_value.m_failur);
+                failur = this->m_storage.TakeFailur();
                 return false;
             }
             else
-            {
-                _Internal::Logger(_Internal::ERROR_LABEL)
-                    .Write(TXT("移動された値にアクセスしよ"
-                               "うとしました。'"))
-                    .Write(TXT("Result<"))
-                    .Write(TypenameOf<S>())
-                    .Write(TXT(", "))
-                    .Write(TypenameOf<F>())
-                    .Write(TXT(">::IsSuccess("))
-                    .Write(TypenameOf<S>())
-                    .Write(TXT(" &success, "))
-                    .Write(TypenameOf<F>())
-                    .Write(TXT(" &failur) noexcept'"));
-
-                ExitError();
-            }
+                this->_ExitMovedAccess(TXT("IsSuccess(S &success, F &failur) noexcept"));
         }
 
         /// 失敗か判定します。
         /// @return 失敗判定値です。
         Bool IsFailur() noexcept
         {
-            return this->m_state == EState::FAILUR;
+            return this->m_storage.IsFailur();
         }
 
         /// 失敗か判定します。
@@ -265,11 +1093,91 @@ namespace FuraiEngine
         {
             if (this->IsFailur())
             {
-                value = Move(this->m_value.m_failur);
+                value = this->m_storage.TakeFailur();
                 return true;
             }
             return false;
         }
+
+        /// 成功値を取り出します。
+        /// @return 成功値です。
+        /// @warning 成功の場合のみ呼び出せます。
+        S &&TakeSuccess() noexcept
+        {
+            return this->m_storage.TakeSuccess();
+        }
+
+        /// 失敗値を取り出します。
+        /// @return 失敗値です。
+        /// @warning 失敗の場合のみ呼び出せます。
+        decltype(auto) TakeFailur() noexcept
+        {
+            return this->m_storage.TakeFailur();
+        }
+
+        /// 成功値を変換します。
+        /// @tparam Function 成功値を受け取り、新たな成功値を返す関数の型です。
+        /// @param function 成功値を受け取り、新たな成功値を返す関数です。
+        /// @return 成功の場合、変換した成功値です。失敗の場合、失敗値です。
+        /// @warning 値の移動後に呼び出した場合、異常終了します。
+        template<typename Function>
+        Result<typename std::invoke_result<Function, S &&>::type, F>
+        Map(Function &&function) && noexcept
+        {
+            using ResultType = Result<typename std::invoke_result<Function, S &&>::type, F>;
+            if (this->IsSuccess())
+                return ResultType(Forward<Function>(function)(this->m_storage.TakeSuccess()));
+            if (!this->IsFailur())
+                this->_ExitMovedAccess(TXT("Map(Function &&function) && noexcept"));
+            return ResultType(this->m_storage.TakeFailur());
+        }
+
+        /// 成功値で失敗する可能性のある処理を続けます。
+        /// @tparam Function 成功値を受け取り、Result<T, F>を返す関数の型です。
+        /// @param function 成功値を受け取り、Result<T, F>を返す関数です。
+        /// @return 成功の場合、関数の戻り値です。失敗の場合、失敗値です。
+        /// @warning 値の移動後に呼び出した場合、異常終了します。
+        template<typename Function>
+        typename std::invoke_result<Function, S &&>::type
+        AndThen(Function &&function) && noexcept
+        {
+            using ResultType = typename std::invoke_result<Function, S &&>::type;
+            if (this->IsSuccess())
+                return Forward<Function>(function)(this->m_storage.TakeSuccess());
+            if (!this->IsFailur())
+                this->_ExitMovedAccess(TXT("AndThen(Function &&function) && noexcept"));
+            return ResultType(this->m_storage.TakeFailur());
+        }
+
+        /// 失敗値から回復する処理を続けます。
+        /// @tparam Function 失敗値を受け取り、Result<S, G>を返す関数の型です。
+        /// @param function 失敗値を受け取り、Result<S, G>を返す関数です。
+        /// @return 成功の場合、成功値です。失敗の場合、関数の戻り値です。
+        /// @warning 値の移動後に呼び出した場合、異常終了します。
+        template<typename Function>
+        typename std::invoke_result<Function, F &&>::type
+        OrElse(Function &&function) && noexcept
+        {
+            using ResultType = typename std::invoke_result<Function, F &&>::type;
+            if (this->IsFailur())
+                return Forward<Function>(function)(this->m_storage.TakeFailur());
+            if (!this->IsSuccess())
+                this->_ExitMovedAccess(TXT("OrElse(Function &&function) && noexcept"));
+            return ResultType(this->m_storage.TakeSuccess());
+        }
+
+        /// 成功値、または、既定値を取得します。
+        /// @param value 失敗の場合の既定値です。
+        /// @return 成功の場合、成功値です。失敗の場合、既定値です。
+        /// @warning 値の移動後に呼び出した場合、異常終了します。
+        [[nodiscard]] S ValueOr(S value) && noexcept
+        {
+            if (this->IsSuccess())
+                return this->m_storage.TakeSuccess();
+            if (!this->IsFailur())
+                this->_ExitMovedAccess(TXT("ValueOr(S value) && noexcept"));
+            return Move(value);
+        }
     };
 
     /// 成功を表現する型です。
@@ -281,24 +1189,16 @@ namespace FuraiEngine
         {}
 
         /// コピーします。
-        constexpr Success(const Success &) noexcept
-        {}
+        constexpr Success(const Success &) noexcept = default;
 
         /// ムーブします。
-        constexpr Success(Success &&) noexcept
-        {}
+        constexpr Success(Success &&) noexcept = default;
 
         /// コピー代入します。
-        constexpr Success &operator=(const Success &) noexcept
-        {
-            return *this;
-        }
+        constexpr Success &operator=(const Success &) noexcept = default;
 
         /// ムーブ代入します。
-        constexpr Success &operator=(Success &&) noexcept
-        {
-            return *this;
-        }
+        constexpr Success &operator=(Success &&) noexcept = default;
     };
 
     /// 失敗を表現する型です。
@@ -310,24 +1210,16 @@ namespace FuraiEngine
         {}
 
         /// コピーします。
-        constexpr Failur(const Failur &) noexcept
-        {}
+        constexpr Failur(const Failur &) noexcept = default;
 
         /// ムーブします。
-        constexpr Failur(Failur &&) noexcept
-        {}
+        constexpr Failur(Failur &&) noexcept = default;
 
         /// コピー代入します。
-        constexpr Failur &operator=(const Failur &) noexcept
-        {
-            return *this;
-        }
+        constexpr Failur &operator=(const Failur &) noexcept = default;
 
         /// ムーブ代入します。
-        constexpr Failur &operator=(Failur &&) noexcept
-        {
-            return *this;
-        }
+        constexpr Failur &operator=(Failur &&) noexcept = default;
     };
 
     /// 成功値です。
@@ -336,4 +1228,54 @@ namespace FuraiEngine
     /// 失敗値です。
     constexpr Failur FAILUR = Failur();
 }
+/// 重要度とカテゴリを指定してログを書式化して出力します。
+/// 重要度がFURAIENGINE_LOG_LEVEL未満の場合、引数の評価を含めて呼び出しを取り除きます。
+/// カテゴリが重要度を出力しない場合、引数を評価しません。
+/// @param LEVEL ELogLevelの列挙子名です。(TRACE、VERBOSE、LOG、WARNING、ERROR)
+/// @param CATEGORY LogCategoryです。
+/// @param ... 書式の文字列リテラルと引数です。
+#define FURAIENGINE_LOG(LEVEL, CATEGORY, ...)                                 \
+    do                                                                       \
+    {                                                                        \
+        if constexpr (::FuraiEngine::ELogLevel::LEVEL                        \
+                      >= ::FuraiEngine::LOG_LEVEL_MIN)                       \
+        {                                                                    \
+            if ((CATEGORY).IsEnabled(::FuraiEngine::ELogLevel::LEVEL))       \
+                ::FuraiEngine::LogAt(                                        \
+                    ::FuraiEngine::ELogLevel::LEVEL, CATEGORY, __VA_ARGS__); \
+        }                                                                    \
+    } while (false)
+
+/// 重要度とカテゴリを指定し、呼び出し箇所ごとに出力回数を制限してログを書式化して出力します。
+/// 1秒あたりの出力回数を超えた分は破棄し、出力の再開時に破棄した回数を出力します。
+/// @param LEVEL ELogLevelの列挙子名です。(TRACE、VERBOSE、LOG、WARNING、ERROR)
+/// @param CATEGORY LogCategoryです。
+/// @param COUNT 1秒あたりに出力する最大の回数です。
+/// @param ... 書式の文字列リテラルと引数です。
+#define FURAIENGINE_LOG_RATE_LIMITED(LEVEL, CATEGORY, COUNT, ...)               \
+    do                                                                         \
+    {                                                                          \
+        if constexpr (::FuraiEngine::ELogLevel::LEVEL                          \
+                      >= ::FuraiEngine::LOG_LEVEL_MIN)                         \
+        {                                                                      \
+            static ::FuraiEngine::LogRateLimiter furaiLogRateLimiter(COUNT);   \
+            if ((CATEGORY).IsEnabled(::FuraiEngine::ELogLevel::LEVEL)          \
+                && furaiLogRateLimiter.TryAcquire(                             \
+                    ::FuraiEngine::ELogLevel::LEVEL, CATEGORY))                \
+                ::FuraiEngine::LogAt(                                          \
+                    ::FuraiEngine::ELogLevel::LEVEL, CATEGORY, __VA_ARGS__);   \
+        }                                                                      \
+    } while (false)
+
+/// Resultが失敗の場合、失敗値を呼び出し元の関数から返し、成功の場合、成功値で変数を宣言します。
+/// 呼び出し元の関数は、同じ失敗値の型を持つResultを返す必要があります。
+/// 変数を宣言するため、if文などの単文の位置では使用できません。
+/// @param VARIABLE 成功値で宣言する変数名です。
+/// @param ... Resultを返す式です。
+#define FURAIENGINE_TRY(VARIABLE, ...)                                       \
+    auto furaiTryResult_##VARIABLE = (__VA_ARGS__);                          \
+    if (furaiTryResult_##VARIABLE.IsFailur())                                \
+        return furaiTryResult_##VARIABLE.TakeFailur();                       \
+    [[maybe_unused]] auto VARIABLE = furaiTryResult_##VARIABLE.TakeSuccess()
+
 #endif // !_FURAIENGINE_UTILITY_HPP
\ No newline at end of file
@@ -0,0 +1,396 @@
+// LogSink.cpp
+// (C) 2022 FuraiEngineCommunity.
+// author Taichi Ito.
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include "FuraiEngine/LogSink.hpp"
+#include "FuraiEngine/Memory.hpp"
+#if defined(_WIN32)
+#define NOMINMAX
+#define NOGDI
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace FuraiEngine;
+
+// --------------------
+//
+// FileLogSink
+//
+// ====================
+
+// 切り替えたファイルのパスを作成します。
+// path 元のパスです。
+// index 番号です。
+// 切り替えたファイルのパスです。
+String RotatedPathOf(const String &path, USize index)
+{
+    char number[24];
+    std::snprintf(number, sizeof(number), ".%llu", (unsigned long long) index);
+    String rotated(path);
+    rotated.Append(StringView((const Char *) number));
+    return rotated;
+}
+
+// ファイルを開きます。
+void FuraiEngine::FileLogSink::_Open() noexcept
+{
+    this->m_pFile      = std::fopen((const char *) this->m_path.Data(), "wb");
+    this->m_size       = 0;
+    this->m_openedTime = std::time(nullptr);
+    if (this->m_pFile == nullptr)
+    {
+        std::cerr << "Failed to create or open the file "
+                  << (const char *) this->m_path.Data() << "." << std::endl;
+    }
+}
+
+// ファイルを切り替えます。
+void FuraiEngine::FileLogSink::_Rotate() noexcept
+{
+    if (this->m_pFile != nullptr)
+        std::fclose(this->m_pFile);
+
+    // path.N-1 -> path.N ... path -> path.1
+    if (this->m_backupsCount > 0)
+    {
+        std::remove((const char *) RotatedPathOf(this->m_path, this->m_backupsCount).Data());
+        for (auto i = this->m_backupsCount - 1; i > 0; i--)
+        {
+            std::rename((const char *) RotatedPathOf(this->m_path, i).Data(),
+                        (const char *) RotatedPathOf(this->m_path, i + 1).Data());
+        }
+        std::rename((const char *) this->m_path.Data(),
+                    (const char *) RotatedPathOf(this->m_path, 1).Data());
+    }
+    this->_Open();
+}
+
+// 初期化し、ファイルを作成します。既にある場合、内容を破棄します。
+// path ファイルのパスです。
+// maxSize 切り替える大きさです。0の場合、大きさで切り替えません。
+// interval 切り替える経過秒数です。0の場合、時間で切り替えません。
+// backupsCount 切り替え後に残すファイルの数です。
+FuraiEngine::FileLogSink::FileLogSink(const Char *path,
+                                      USize       maxSize,
+                                      U64         interval,
+                                      USize       backupsCount) noexcept
+    : m_path(path)
+    , m_pFile(nullptr)
+    , m_size(0)
+    , m_maxSize(maxSize)
+    , m_interval(interval)
+    , m_backupsCount(backupsCount)
+    , m_openedTime(0)
+{
+    this->_Open();
+}
+
+// 解体し、ファイルを閉じます。
+FuraiEngine::FileLogSink::~FileLogSink() noexcept
+{
+    if (this->m_pFile != nullptr)
+        std::fclose(this->m_pFile);
+}
+
+// 行の並びを書き込みます。
+// pData 文字の並びです。
+// size 文字数です。
+void FuraiEngine::FileLogSink::Write(const Char *pData, USize size) noexcept
+{
+    if (this->m_interval != 0
+        && (U64) (std::time(nullptr) - this->m_openedTime) >= this->m_interval)
+        this->_Rotate();
+
+    while (size > 0)
+    {
+        // 大きさで切り替える場合、行の区切りで分割します
+        auto count = size;
+        if (this->m_maxSize != 0 && this->m_size + size > this->m_maxSize)
+        {
+            auto room = this->m_size < this->m_maxSize ? this->m_maxSize - this->m_size : 0;
+            count     = 0;
+            for (auto i = room; i > 0; i--)
+            {
+                if (pData[i - 1] == '\n')
+                {
+                    count = i;
+                    break;
+                }
+            }
+            if (count == 0 && this->m_size != 0)
+            {
+                this->_Rotate();
+                continue;
+            }
+            if (count == 0) // 1行が切り替える大きさを超える場合、その行のみ書き込みます
+            {
+                auto pEnd = (const Char *) std::memchr(pData, '\n', size);
+                count     = pEnd != nullptr ? (USize) (pEnd - pData) + 1 : size;
+            }
+        }
+
+        if (this->m_pFile != nullptr)
+            std::fwrite(pData, 1, count, this->m_pFile);
+        this->m_size += count;
+        pData += count;
+        size -= count;
+    }
+}
+
+// 書き込んだ内容をファイルへ反映します。
+void FuraiEngine::FileLogSink::Flush() noexcept
+{
+    if (this->m_pFile != nullptr)
+        std::fflush(this->m_pFile);
+}
+
+// --------------------
+//
+// StderrLogSink
+//
+// ====================
+
+// 行の並びを書き込みます。
+// pData 文字の並びです。
+// size 文字数です。
+void FuraiEngine::StderrLogSink::Write(const Char *pData, USize size) noexcept
+{
+    std::fwrite(pData, 1, size, stderr);
+}
+
+// 書き込んだ内容を標準エラー出力へ反映します。
+void FuraiEngine::StderrLogSink::Flush() noexcept
+{
+    std::fflush(stderr);
+}
+
+// --------------------
+//
+// MemoryLogSink
+//
+// ====================
+
+// 容量を指定して初期化します。
+// capacity 容量です。0の場合、1として扱います。
+// メモリ確保に失敗した場合、異常終了します。
+FuraiEngine::MemoryLogSink::MemoryLogSink(USize capacity) noexcept
+    : m_mutexF()
+    , m_pData(nullptr)
+    , m_capacity(capacity == 0 ? 1 : capacity)
+    , m_position(0)
+{
+    if (!Allocator<Char>().Allocate(this->m_capacity).IsSuccess(this->m_pData))
+    {
+        LogError(TXT("メモリの確保に失敗しました。"
+                     "'MemoryLogSink::MemoryLogSink(USize capacity) noexcept'"));
+
+        ExitError();
+    }
+}
+
+// 解体します。
+FuraiEngine::MemoryLogSink::~MemoryLogSink() noexcept
+{
+    static_cast<void>(
+        Allocator<Char>().Deallocate(this->m_pData, this->m_capacity));
+}
+
+// 行の並びを書き込みます。容量を超えた分は古いものから上書きします。
+// pData 文字の並びです。
+// size 文字数です。
+void FuraiEngine::MemoryLogSink::Write(const Char *pData, USize size) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->m_mutexF);
+    if (size > this->m_capacity) // 収まる末尾のみ残します
+    {
+        this->m_position += size - this->m_capacity;
+        pData += size - this->m_capacity;
+        size = this->m_capacity;
+    }
+    auto offset = (USize) (this->m_position % this->m_capacity);
+    auto first  = size < this->m_capacity - offset ? size : this->m_capacity - offset;
+    std::memcpy(&this->m_pData[offset], pData, first);
+    std::memcpy(this->m_pData, pData + first, size - first);
+    this->m_position += size;
+}
+
+// 保持する最新の出力を複写します。
+// pData 複写先です。
+// size 複写先の大きさです。
+// 複写した文字数です。
+USize FuraiEngine::MemoryLogSink::Read(Char *pData, USize size) const noexcept
+{
+    std::lock_guard<std::mutex> lock(this->m_mutexF);
+    auto stored = this->m_position < this->m_capacity ? (USize) this->m_position
+                                                      : this->m_capacity;
+    auto count  = size < stored ? size : stored;
+    auto begin  = this->m_position - count;
+    auto offset = (USize) (begin % this->m_capacity);
+    auto first  = count < this->m_capacity - offset ? count : this->m_capacity - offset;
+    std::memcpy(pData, &this->m_pData[offset], first);
+    std::memcpy(pData + first, this->m_pData, count - first);
+    return count;
+}
+
+// --------------------
+//
+// MappedFileLogSink
+//
+// ====================
+
+// マップしたファイルのヘッダです。
+struct MappedLogHeader
+{
+    char magic[8]; // 'FURAILOG'です。
+    U64  capacity; // 容量です。
+    U64  position; // これまでに書き込んだ文字数です。
+};
+
+// マップしたファイルのヘッダの大きさです。
+constexpr USize MAPPED_LOG_HEADER_SIZE = 64;
+
+// 初期化し、ファイルを作成してマップします。既にある場合、内容を破棄します。
+// 失敗した場合、書き込みは破棄されます。
+// path ファイルのパスです。
+// capacity 容量です。
+FuraiEngine::MappedFileLogSink::MappedFileLogSink(const Char *path,
+                                                  USize       capacity) noexcept
+    : m_pFile(nullptr)
+    , m_pMappingObject(nullptr)
+    , m_pView(nullptr)
+    , m_capacity(capacity)
+{
+    if (capacity == 0)
+        return;
+
+    auto size = MAPPED_LOG_HEADER_SIZE + capacity;
+#if defined(_WIN32)
+    // UTF-8のパスをUTF-16へ変換します
+    auto     length    = MultiByteToWideChar(CP_UTF8, 0, (const char *) path, -1, nullptr, 0);
+    wchar_t *pWidePath = nullptr;
+    if (length <= 0
+        || !Allocator<wchar_t>().Allocate((USize) length).IsSuccess(pWidePath))
+    {
+        std::cerr << "Failed to create or open the file " << (const char *) path
+                  << "." << std::endl;
+        return;
+    }
+    MultiByteToWideChar(CP_UTF8, 0, (const char *) path, -1, pWidePath, length);
+    auto hFile = CreateFileW(pWidePath,
+                             GENERIC_READ | GENERIC_WRITE,
+                             FILE_SHARE_READ,
+                             nullptr,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+    static_cast<void>(
+        Allocator<wchar_t>().Deallocate(pWidePath, (USize) length));
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        std::cerr << "Failed to create or open the file " << (const char *) path
+                  << "." << std::endl;
+        return;
+    }
+    auto hMapping = CreateFileMappingW(hFile,
+                                       nullptr,
+                                       PAGE_READWRITE,
+                                       (DWORD) ((U64) size >> 32),
+                                       (DWORD) size,
+                                       nullptr);
+    auto pView = hMapping != nullptr
+                   ? MapViewOfFile(hMapping, FILE_MAP_WRITE, 0, 0, size)
+                   : nullptr;
+    if (pView == nullptr)
+    {
+        std::cerr << "Failed to map the file " << (const char *) path << "."
+                  << std::endl;
+        if (hMapping != nullptr)
+            CloseHandle(hMapping);
+        CloseHandle(hFile);
+        return;
+    }
+    this->m_pFile          = (void *) hFile;
+    this->m_pMappingObject = (void *) hMapping;
+    this->m_pView          = (U8 *) pView;
+#else
+    auto file = open((const char *) path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file < 0)
+    {
+        std::cerr << "Failed to create or open the file " << (const char *) path
+                  << "." << std::endl;
+        return;
+    }
+    auto pView = ftruncate(file, (off_t) size) == 0
+                   ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)
+                   : MAP_FAILED;
+    if (pView == MAP_FAILED)
+    {
+        std::cerr << "Failed to map the file " << (const char *) path << "."
+                  << std::endl;
+        close(file);
+        return;
+    }
+    this->m_pFile = (void *) (ISize) file;
+    this->m_pView = (U8 *) pView;
+#endif
+
+    MappedLogHeader header;
+    std::memcpy(header.magic, "FURAILOG", sizeof(header.magic));
+    header.capacity = capacity;
+    header.position = 0;
+    std::memcpy(this->m_pView, &header, sizeof(header));
+}
+
+// 解体し、マップを解除します。
+FuraiEngine::MappedFileLogSink::~MappedFileLogSink() noexcept
+{
+    if (this->m_pView == nullptr)
+        return;
+#if defined(_WIN32)
+    UnmapViewOfFile(this->m_pView);
+    CloseHandle((HANDLE) this->m_pMappingObject);
+    CloseHandle((HANDLE) this->m_pFile);
+#else
+    munmap(this->m_pView, MAPPED_LOG_HEADER_SIZE + this->m_capacity);
+    close((int) (ISize) this->m_pFile);
+#endif
+}
+
+// 行の並びを書き込みます。容量を超えた分は古いものから上書きします。
+// pData 文字の並びです。
+// size 文字数です。
+void FuraiEngine::MappedFileLogSink::Write(const Char *pData, USize size) noexcept
+{
+    if (this->m_pView == nullptr)
+        return;
+
+    U64 position;
+    std::memcpy(&position,
+                this->m_pView + offsetof(MappedLogHeader, position),
+                sizeof(position));
+    if (size > this->m_capacity) // 収まる末尾のみ残します
+    {
+        position += size - this->m_capacity;
+        pData += size - this->m_capacity;
+        size = this->m_capacity;
+    }
+    auto pRing  = this->m_pView + MAPPED_LOG_HEADER_SIZE;
+    auto offset = (USize) (position % this->m_capacity);
+    auto first  = size < this->m_capacity - offset ? size : this->m_capacity - offset;
+    std::memcpy(&pRing[offset], pData, first);
+    std::memcpy(pRing, pData + first, size - first);
+    position += size;
+    std::memcpy(this->m_pView + offsetof(MappedLogHeader, position),
+                &position,
+                sizeof(position));
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+// Name.cpp
+// (C) 2022 FuraiEngineCommunity.
+// author Taichi Ito.
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include "FuraiEngine/Collections/ConcurrentHashMap.hpp"
+#include "FuraiEngine/Name.hpp"
+
+using namespace FuraiEngine;
+
+// --------------------
+//
+// 名前表
+//
+// ====================
+
+constexpr USize NAME_PAGE_SIZE       = 4096;      // 1ページあたりの名前の数です。
+constexpr USize NAME_PAGES_COUNT_MAX = 1024;      // ページ数の上限です。
+constexpr USize NAME_TEXT_CHUNK_SIZE = 64 * 1024; // 文字列を格納する領域の1ブロックのサイズです。
+
+// 名前表のキーです。
+class NameKey
+{
+public:
+    // 文字列です。
+    StringView text;
+    // 文字列のハッシュ値です。
+    U64 hash;
+
+    // 同等か比較します。
+    // @param other 比較対象です。
+    // @return 同等の場合、真です。
+    Bool operator==(const NameKey &other) const noexcept
+    {
+        return this->hash == other.hash && this->text == other.text;
+    }
+};
+
+// 名前表のキーのハッシュ関数オブジェクトです。
+// 計算済みのハッシュ値をそのまま使用します。
+template<>
+class FuraiEngine::Hash<NameKey>
+{
+public:
+    // ハッシュ値を取得します。
+    // @param value 対象の値です。
+    // @return ハッシュ値です。
+    USize operator()(const NameKey &value) const noexcept
+    {
+        return (USize) value.hash;
+    }
+};
+
+// 名前表です。
+// 文字列から識別子への検索はロックせずに行い、新しい名前の登録のみ占有ロックします。
+// 識別子から文字列への変換はページ配列を辿るだけで、ロックしません。
+class NameTable
+{
+    ConcurrentHashMap<NameKey, U32> m_ids; // 文字列から識別子への表です。
+    std::atomic<StringView *> m_pPages[NAME_PAGES_COUNT_MAX]; // 識別子から文字列への表です。
+    std::mutex m_mutexF;    // 登録の占有ロックフラグです。
+    U32        m_count;     // 登録した名前の数です。
+    Char      *m_pChunk;    // 文字列を格納中の領域です。
+    USize      m_chunkRest; // 領域の残りバイト数です。
+
+    // 文字列を複製します。複製した文字列は解放しません。
+    // @param text 複製する文字列です。
+    // @return ヌル終端された複製です。
+    StringView _CopyText(StringView text) noexcept
+    {
+        auto size = text.Count() + 1;
+        if (size > this->m_chunkRest)
+        {
+            auto chunkSize =
+                size > NAME_TEXT_CHUNK_SIZE ? size : NAME_TEXT_CHUNK_SIZE;
+            if (!Allocator<Char>().Allocate(chunkSize).IsSuccess(this->m_pChunk))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'StringView NameTable::_CopyText(StringView "
+                             "text) noexcept'"));
+
+                ExitError();
+            }
+            this->m_chunkRest = chunkSize;
+        }
+        auto pText = this->m_pChunk;
+        std::memcpy(pText, text.Data(), text.Count());
+        pText[text.Count()] = 0;
+        this->m_pChunk += size;
+        this->m_chunkRest -= size;
+        return StringView(pText, text.Count());
+    }
+
+    // 識別子に文字列を割り当てます。
+    // @param id 識別子です。
+    // @param text 文字列です。
+    void _Publish(U32 id, StringView text) noexcept
+    {
+        auto pageIndex = id / NAME_PAGE_SIZE;
+        if (pageIndex >= NAME_PAGES_COUNT_MAX)
+        {
+            LogError(TXT("登録できる名前の数を超えました。"
+                         "'void NameTable::_Publish(U32 id, StringView text) "
+                         "noexcept'"));
+
+            ExitError();
+        }
+        auto pPage = this->m_pPages[pageIndex].load(std::memory_order_relaxed);
+        if (pPage == nullptr)
+        {
+            if (!Allocator<StringView>().Allocate(NAME_PAGE_SIZE).IsSuccess(
+                    pPage))
+            {
+                LogError(TXT("メモリの確保に失敗しました。"
+                             "'void NameTable::_Publish(U32 id, StringView "
+                             "text) noexcept'"));
+
+                ExitError();
+            }
+            this->m_pPages[pageIndex].store(pPage, std::memory_order_release);
+        }
+        new (&pPage[id % NAME_PAGE_SIZE]) StringView(text);
+    }
+
+public:
+    // 初期化します。識別子0に空の名前を登録します。
+    NameTable() noexcept
+        : m_ids()
+        , m_mutexF()
+        , m_count(1)
+        , m_pChunk(nullptr)
+        , m_chunkRest(0)
+    {
+        for (USize i = 0; i < NAME_PAGES_COUNT_MAX; i++)
+            this->m_pPages[i].store(nullptr, std::memory_order_relaxed);
+        this->_Publish(0, StringView());
+    }
+
+    // 文字列を登録し、識別子を取得します。
+    // @param text 文字列です。
+    // @param hash 文字列のハッシュ値です。
+    // @return 識別子です。
+    U32 Intern(StringView text, U64 hash) noexcept
+    {
+        // 登録済みの名前はロックせずに見つけます。
+        auto pId = this->m_ids.Find(NameKey {text, hash});
+        if (pId != nullptr)
+            return *pId;
+
+        std::lock_guard<std::mutex> lock(this->m_mutexF);
+        pId = this->m_ids.Find(NameKey {text, hash});
+        if (pId != nullptr)
+            return *pId;
+        auto id   = this->m_count;
+        auto copy = this->_CopyText(text);
+        this->_Publish(id, copy);
+        this->m_ids.Add(NameKey {copy, hash}, id);
+        this->m_count += 1;
+        return id;
+    }
+
+    // 識別子から文字列を取得します。
+    // @param id 識別子です。
+    // @return 文字列です。
+    StringView TextOf(U32 id) const noexcept
+    {
+        auto pPage = this->m_pPages[id / NAME_PAGE_SIZE].load(
+            std::memory_order_acquire);
+        return pPage[id % NAME_PAGE_SIZE];
+    }
+};
+
+// 名前表を取得します。初回呼び出し時に初期化します。
+NameTable &GetNameTable() noexcept
+{
+    static NameTable table;
+    return table;
+}
+
+// --------------------
+//
+// Name
+//
+// ====================
+
+// 文字列を登録し、識別子を取得します。
+// text 文字列です。
+// hash 文字列のハッシュ値です。
+// メモリ確保に失敗した場合、異常終了します。
+U32 FuraiEngine::Name::_Intern(StringView text, U64 hash) noexcept
+{
+    if (text.IsEmpty())
+        return 0;
+    return GetNameTable().Intern(text, hash);
+}
+
+// 文字列を取得します。ロックしません。
+StringView FuraiEngine::Name::Text() const noexcept
+{
+    if (this->m_id == 0)
+        return StringView();
+    return GetNameTable().TextOf(this->m_id);
+}
\ No newline at end of file
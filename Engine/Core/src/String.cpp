@@ -0,0 +1,213 @@
+// String.cpp
+// (C) 2022 FuraiEngineCommunity.
+// author Taichi Ito.
+
+#include <cstring>
+#include "FuraiEngine/String.hpp"
+
+using namespace FuraiEngine;
+
+// --------------------
+//
+// String
+//
+// ====================
+
+// バイト数を設定し、ヌル終端を書き込みます。
+void FuraiEngine::String::_SetCount(USize count) noexcept
+{
+    if (this->_IsLocal())
+    {
+        this->_SetLocalCount(count);
+    }
+    else
+    {
+        this->m_heap.count        = count;
+        this->m_heap.pData[count] = 0;
+    }
+}
+
+// 容量を変更し、文字列を追加します。
+// 追加する文字列は自身の一部であっても構いません。
+// capacity 新しい容量です。
+// append 追加する文字列です。
+void FuraiEngine::String::_Reallocate(USize capacity, StringView append) noexcept
+{
+    Char *pData = nullptr;
+    if (!Allocator<Char>().Allocate(capacity + 1).IsSuccess(pData))
+    {
+        LogError(TXT("メモリの確保に失敗しました。"
+                     "'void String::_Reallocate(USize capacity, StringView "
+                     "append) noexcept'"));
+
+        ExitError();
+    }
+    // 追加する文字列が古い領域を指す場合に備え、解放前に複製します。
+    auto count = this->Count();
+    std::memcpy(pData, this->Data(), count);
+    if (!append.IsEmpty())
+        std::memcpy(pData + count, append.Data(), append.Count());
+    this->_Release();
+    this->m_heap.pData    = pData;
+    this->m_heap.capacity = capacity | HEAP_FLAG;
+    this->_SetCount(count + append.Count());
+}
+
+// ヒープの領域を解放します。
+void FuraiEngine::String::_Release() noexcept
+{
+    if (this->_IsLocal())
+        return;
+    static_cast<void>(Allocator<Char>().Deallocate(
+        this->m_heap.pData, (this->m_heap.capacity & ~HEAP_FLAG) + 1));
+    this->_SetLocalCount(0);
+}
+
+// 空の文字列で初期化します。
+FuraiEngine::String::String() noexcept
+{
+    this->_SetLocalCount(0);
+}
+
+// ヌル終端文字列から初期化します。
+// string ヌル終端文字列です。
+// メモリ確保に失敗した場合、異常終了します。
+FuraiEngine::String::String(const Char *string) noexcept
+    : String(StringView(string))
+{
+}
+
+// 文字列の参照から初期化します。
+// string 文字列の参照です。
+// メモリ確保に失敗した場合、異常終了します。
+FuraiEngine::String::String(StringView string) noexcept
+{
+    this->_SetLocalCount(0);
+    this->Append(string);
+}
+
+// コピーします。
+// origin コピー元です。
+// メモリ確保に失敗した場合、異常終了します。
+FuraiEngine::String::String(const String &origin) noexcept
+    : String(origin.View())
+{
+}
+
+// ムーブします。ヒープの領域は所有権を移すだけで複製しません。
+// origin ムーブ元です。
+FuraiEngine::String::String(String &&origin) noexcept
+{
+    std::memcpy((void *) this, (const void *) &origin, sizeof(String));
+    origin._SetLocalCount(0);
+}
+
+// 解体します。
+FuraiEngine::String::~String() noexcept
+{
+    this->_Release();
+}
+
+// コピー代入します。
+// origin コピー元です。
+// メモリ確保に失敗した場合、異常終了します。
+String &FuraiEngine::String::operator=(const String &origin) noexcept
+{
+    return *this = origin.View();
+}
+
+// ムーブ代入します。
+// origin ムーブ元です。
+String &FuraiEngine::String::operator=(String &&origin) noexcept
+{
+    if (this != &origin)
+    {
+        this->_Release();
+        std::memcpy((void *) this, (const void *) &origin, sizeof(String));
+        origin._SetLocalCount(0);
+    }
+    return *this;
+}
+
+// 文字列の参照を代入します。
+// string 文字列の参照です。自身の一部であっても構いません。
+// メモリ確保に失敗した場合、異常終了します。
+String &FuraiEngine::String::operator=(StringView string) noexcept
+{
+    if (string.Count() > this->Capacity())
+    {
+        this->_SetCount(0);
+        this->_Reallocate(string.Count(), string);
+    }
+    else
+    {
+        // 自身の一部の場合もあるため、memmoveで複製します。
+        std::memmove(this->Data(), string.Data(), string.Count());
+        this->_SetCount(string.Count());
+    }
+    return *this;
+}
+
+// 容量を予約します。
+// capacity 予約するバイト数です。
+// メモリ確保に失敗した場合、異常終了します。
+void FuraiEngine::String::Reserve(USize capacity) noexcept
+{
+    if (capacity > this->Capacity())
+        this->_Reallocate(capacity, StringView());
+}
+
+// 空にします。容量は維持します。
+void FuraiEngine::String::Clear() noexcept
+{
+    this->_SetCount(0);
+}
+
+// 文字列を追加します。
+// string 追加する文字列です。自身の一部であっても構いません。
+// メモリ確保に失敗した場合、異常終了します。
+String &FuraiEngine::String::Append(StringView string) noexcept
+{
+    auto count    = this->Count();
+    auto required = count + string.Count();
+    auto capacity = this->Capacity();
+    if (required > capacity)
+    {
+        // 追加を繰り返しても償却O(1)となるよう、容量は2倍以上に拡張します。
+        this->_Reallocate(required > capacity * 2 ? required : capacity * 2,
+                          string);
+    }
+    else if (!string.IsEmpty())
+    {
+        std::memmove(this->Data() + count, string.Data(), string.Count());
+        this->_SetCount(required);
+    }
+    return *this;
+}
+
+// 文字を追加します。
+// character 追加する文字です。
+// メモリ確保に失敗した場合、異常終了します。
+String &FuraiEngine::String::Append(Char character) noexcept
+{
+    return this->Append(StringView(&character, 1));
+}
+
+// --------------------
+//
+// 文字列の演算
+//
+// ====================
+
+// 文字列を連結します。
+// left 左辺です。
+// right 右辺です。
+// メモリ確保に失敗した場合、異常終了します。
+String FuraiEngine::operator+(StringView left, StringView right) noexcept
+{
+    String result;
+    result.Reserve(left.Count() + right.Count());
+    result.Append(left);
+    result.Append(right);
+    return result;
+}
\ No newline at end of file
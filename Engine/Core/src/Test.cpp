@@ -2,12 +2,46 @@
 // (C) 2022 FuraiEngineCommunity.
 // author Taichi Ito.
 
+#include <atomic>
 #include <iostream>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <typeinfo>
+#include "FuraiEngine/Collections/BitArray.hpp"
+#include "FuraiEngine/Collections/BitSet.hpp"
+#include "FuraiEngine/Collections/ConcurrentHashMap.hpp"
+#include "FuraiEngine/Collections/FlatMap.hpp"
+#include "FuraiEngine/Collections/HashMap.hpp"
+#include "FuraiEngine/Collections/IntrusiveHashTable.hpp"
+#include "FuraiEngine/Collections/MpmcQueue.hpp"
+#include "FuraiEngine/Collections/PersistentArray.hpp"
+#include "FuraiEngine/Collections/PriorityQueue.hpp"
+#include "FuraiEngine/Collections/Span.hpp"
+#include "FuraiEngine/Collections/SparseSet.hpp"
+#include "FuraiEngine/Collections/SpscRingBuffer.hpp"
+#include "FuraiEngine/LogSink.hpp"
+#include "FuraiEngine/Memory.hpp"
+#include "FuraiEngine/Name.hpp"
+#include "FuraiEngine/Sort.hpp"
+#include "FuraiEngine/String.hpp"
+#include "FuraiEngine/Unicode.hpp"
 #include "FuraiEngine/Utility.hpp"
 
 using namespace FuraiEngine;
 
+/// 侵入型コンテナのテスト用の要素です。
+class IntrusiveTestObject
+{
+public:
+    U32               id;
+    IntrusiveListHook listHook;
+    IntrusiveHashHook hashHook;
+};
+
+/// テスト用のログカテゴリです。
+LogCategory g_testLogCategory(TXT("Test"));
+
 Result<U32, Bool> ResultTest(Bool b) noexcept
 {
     if (b)
@@ -20,6 +54,12 @@ Result<U32, Bool> ResultTest(Bool b) noexcept
     }
 }
 
+Result<U32, Bool> ResultTryTest(Bool b) noexcept
+{
+    FURAIENGINE_TRY(value, ResultTest(b));
+    return value + 1;
+}
+
 int main()
 {
     std::cout << "Test start." << std::endl;
@@ -31,6 +71,92 @@ int main()
     Log(TXT("Test, log! テストです。"));
     LogWarning(TXT("Test, warning! テストです。"));
     LogError(TXT("Test, error! テストです。"));
+    Log(TXT("Test, format! {} {} {}"), 17, 0.5, TXT("テストです。"));
+    FURAIENGINE_LOG(WARNING, g_testLogCategory, TXT("Test, category! {}"), 17);
+    g_testLogCategory.SetLevel(ELogLevel::NONE);
+    FURAIENGINE_LOG(ERROR, g_testLogCategory, TXT("Test, filtered! {}"), 17);
+    FlushLog();
+    {
+        MemoryLogSink sink(16 * 1024);
+        AddLogSink(&sink);
+        Log(TXT("Test, sink! {}"), 17);
+        FlushLog();
+        static Char buffer[16 * 1024];
+        auto        count = sink.Read(buffer, 16 * 1024);
+        auto       *pEnd  = TXT("Test, sink! 17\n");
+        auto        size  = std::char_traits<Char>::length(pEnd);
+        if (count >= size
+            && std::char_traits<Char>::compare(buffer + count - size, pEnd, size) == 0)
+            std::cout << "Test is successed." << std::endl;
+        else
+            std::cout << "Test is failed." << std::endl;
+
+        DumpLogFlightRecorder();
+        RemoveLogSink(&sink);
+        count = sink.Read(buffer, 16 * 1024);
+        pEnd  = TXT("Test, sink! 17\n---- End of flight recorder ----\n");
+        size  = std::char_traits<Char>::length(pEnd);
+        if (count >= size
+            && std::char_traits<Char>::compare(buffer + count - size, pEnd, size) == 0)
+            std::cout << "Test is successed." << std::endl;
+        else
+            std::cout << "Test is failed." << std::endl;
+    }
+    {
+        MemoryLogSink sink(16 * 1024);
+        AddLogSink(&sink);
+        for (auto i = 0; i < 100; i++)
+            FURAIENGINE_LOG_RATE_LIMITED(
+                LOG, DefaultLogCategory(), 3, TXT("Test, rate limit! {}"), i);
+        for (auto i = 0; i < 100; i++)
+            Log(TXT("Test, repeat! {}"), 17);
+        FlushLog();
+        RemoveLogSink(&sink);
+        static Char buffer[16 * 1024];
+        auto count = sink.Read(buffer, 16 * 1024);
+        std::basic_string_view<Char> text(buffer, count);
+        auto rateLimitedCount = 0;
+        for (auto i = text.find(TXT("Test, rate limit!")); i != text.npos;
+             i = text.find(TXT("Test, rate limit!"), i + 1))
+            rateLimitedCount++;
+        std::basic_string_view<Char> suppressed(TXT(" messages were suppressed by the rate limit.\n"));
+        std::basic_string_view<Char> end(TXT(" : Previous message repeated 99 times.\n"));
+        auto repeatedPosition = text.find(end);
+        if (rateLimitedCount >= 3 && rateLimitedCount <= 6 && repeatedPosition != text.npos
+            && text.find(suppressed, repeatedPosition) != text.npos)
+            std::cout << "Test is successed." << std::endl;
+        else
+            std::cout << "Test is failed." << std::endl;
+    }
+    {
+        MemoryLogSink sink(16 * 1024);
+        AddLogSink(&sink);
+        Log(TXT("Test, text! {} {} {}"),
+            String(TXT("Furai")),
+            StringView(TXT("Engine")),
+            Name(StringView(TXT("Log"))));
+        FlushLog();
+        RemoveLogSink(&sink);
+        static Char buffer[16 * 1024];
+        auto count = sink.Read(buffer, 16 * 1024);
+        std::basic_string_view<Char> text(buffer, count);
+        std::basic_string_view<Char> end(TXT("Test, text! Furai Engine Log\n"));
+        if (text.size() >= end.size()
+            && text.substr(text.size() - end.size()) == end)
+            std::cout << "Test is successed." << std::endl;
+        else
+            std::cout << "Test is failed." << std::endl;
+    }
+    {
+        MemoryLogSink sink(0); // 容量は1として扱います
+        sink.Write(TXT("Test, empty!\n"), 13);
+        Char buffer[16];
+        auto count = sink.Read(buffer, 16);
+        if (count == 1 && buffer[0] == '\n')
+            std::cout << "Test is successed." << std::endl;
+        else
+            std::cout << "Test is failed." << std::endl;
+    }
     std::cout << "Test 'Log' end" << std::endl;
 
     //
@@ -49,8 +175,479 @@ int main()
                   << resultFalse << std::endl;
     else
         std::cout << "Test is failed." << std::endl;
+    static_assert(std::is_trivially_copyable<Result<U32, Bool>>::value,
+                  "Result<U32, Bool>はトリビアルにコピー可能である必要があります。");
+    static_assert(sizeof(Result<void *, EBadAllocatedError>) == sizeof(void *),
+                  "Result<void *, EBadAllocatedError>はポインタと同じ大きさである必要があります。");
+    U32               *pResultValue = nullptr;
+    EBadAllocatedError resultError  = EBadAllocatedError::ZERO_SIZE;
+    Result<U32 *, EBadAllocatedError> resultPointer(&resultTrue);
+    Result<U32 *, EBadAllocatedError> resultPointerError(EBadAllocatedError::BAD_ALLOCATED_MEMORY);
+    if (resultPointer.IsSuccess(pResultValue) && pResultValue == &resultTrue
+        && resultPointerError.IsFailur(resultError)
+        && resultError == EBadAllocatedError::BAD_ALLOCATED_MEMORY
+        && Result<U32 *, EBadAllocatedError>((U32 *) nullptr).IsSuccess())
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    auto resultMapped =
+        ResultTest(true)
+            .Map([](U32 value) { return value * 2; })
+            .AndThen([](U32 value) { return Result<U32, Bool>(value + 1); })
+            .ValueOr(0);
+    auto resultRecovered =
+        ResultTest(false)
+            .OrElse([](Bool) { return Result<U32, Bool>((U32) 3); })
+            .ValueOr(0);
+    U32 resultTried = 0;
+    if (resultMapped == 35 && resultRecovered == 3
+        && ResultTryTest(true).IsSuccess(resultTried) && resultTried == 18
+        && ResultTryTest(false).IsFailur())
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
     std::cout << "Test 'Result' end" << std::endl;
 
+    //
+    // HashMap
+    //
+    std::cout << "Test 'HashMap' start." << std::endl;
+    HashMap<U32, U32> hashMap;
+    for (U32 i = 0; i < 1000; i++)
+        hashMap.Add(i, i * 2);
+    for (U32 i = 0; i < 1000; i += 2)
+        hashMap.Remove(i);
+    auto pHashMapValue = hashMap.Find((U32) 501);
+    if (hashMap.Count() == 500 && pHashMapValue != nullptr
+        && *pHashMapValue == 1002 && !hashMap.Contains((U32) 500))
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'HashMap' end" << std::endl;
+
+    //
+    // ConcurrentHashMap
+    //
+    std::cout << "Test 'ConcurrentHashMap' start." << std::endl;
+    ConcurrentHashMap<U32, U32> concurrentHashMap;
+    for (U32 i = 0; i < 1000; i++)
+        concurrentHashMap.Add(i, i * 2);
+    concurrentHashMap.Remove((U32) 10);
+    concurrentHashMap.Set((U32) 11, (U32) 0);
+    auto pConcurrentValue = concurrentHashMap.Find((U32) 11);
+    constexpr U32 MAP_WRITER_COUNT = 2;
+    constexpr U32 MAP_READER_COUNT = 4;
+    constexpr U32 MAP_KEY_COUNT    = 256;
+    ConcurrentHashMap<U32, U32> sharedHashMap;
+    std::atomic<Bool>           isMapWriting(true);
+    std::atomic<Bool>           isMapReadValid(true);
+    Array<std::thread>          mapThreads;
+    for (U32 t = 0; t < MAP_WRITER_COUNT; t++)
+    {
+        mapThreads.Add(std::thread(
+            [&sharedHashMap, t]()
+            {
+                for (U32 n = 0; n < 200; n++)
+                {
+                    for (U32 i = 0; i < MAP_KEY_COUNT; i++)
+                    {
+                        auto key = t * MAP_KEY_COUNT + i;
+                        if ((n + i) % 3 == 0)
+                            sharedHashMap.Remove(key);
+                        else
+                            sharedHashMap.Set(key, key * 2);
+                    }
+                }
+                for (U32 i = 0; i < MAP_KEY_COUNT; i++)
+                    sharedHashMap.Set(t * MAP_KEY_COUNT + i,
+                                      (t * MAP_KEY_COUNT + i) * 2);
+            }));
+    }
+    for (U32 t = 0; t < MAP_READER_COUNT; t++)
+    {
+        mapThreads.Add(std::thread(
+            [&sharedHashMap, &isMapWriting, &isMapReadValid]()
+            {
+                while (isMapWriting.load())
+                {
+                    auto guard = sharedHashMap.Pin();
+                    for (U32 key = 0; key < MAP_WRITER_COUNT * MAP_KEY_COUNT;
+                         key++)
+                    {
+                        auto pValue = sharedHashMap.Find(key);
+                        if (pValue != nullptr && *pValue != key * 2)
+                            isMapReadValid.store(false);
+                    }
+                }
+            }));
+    }
+    for (U32 t = 0; t < MAP_WRITER_COUNT; t++)
+        mapThreads[t].join();
+    isMapWriting.store(false);
+    for (U32 t = MAP_WRITER_COUNT; t < mapThreads.Count(); t++)
+        mapThreads[t].join();
+    if (concurrentHashMap.Count() == 999
+        && !concurrentHashMap.Contains((U32) 10)
+        && pConcurrentValue != nullptr && *pConcurrentValue == 0
+        && isMapReadValid.load()
+        && sharedHashMap.Count() == MAP_WRITER_COUNT * MAP_KEY_COUNT)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'ConcurrentHashMap' end" << std::endl;
+
+    //
+    // Array
+    //
+    std::cout << "Test 'Array' start." << std::endl;
+    Array<String> stringArray;
+    for (U32 i = 0; i < 8; i++)
+        stringArray.Add(String(TXT("FuraiEngine/Assets/Textures/")));
+    stringArray[1] = String(TXT("FuraiEngine/Assets/Sounds/"));
+    stringArray.Add(stringArray[0]); // 拡張時に自身の要素を追加します
+    stringArray.Resize(40, stringArray[1]);
+    Array<String> movedStringArray(Move(stringArray));
+    Array<String> copiedStringArray(stringArray); // ムーブ元のコピーです
+    copiedStringArray.Add(movedStringArray[8]);
+    if (movedStringArray.Count() == 40
+        && movedStringArray[8] == TXT("FuraiEngine/Assets/Textures/")
+        && movedStringArray[39] == TXT("FuraiEngine/Assets/Sounds/")
+        && copiedStringArray.Count() == 1
+        && copiedStringArray[0] == TXT("FuraiEngine/Assets/Textures/"))
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Array' end" << std::endl;
+
+    //
+    // FlatMap
+    //
+    std::cout << "Test 'FlatMap' start." << std::endl;
+    Array<KeyValuePair<U32, U32>> flatMapElements;
+    for (U32 i = 0; i < 100; i++)
+        flatMapElements.Add(KeyValuePair<U32, U32>(99 - i, i));
+    FlatMap<U32, U32> flatMap(Move(flatMapElements));
+    auto              pFlatMapValue = flatMap.Find((U32) 10);
+    if (flatMap.Count() == 100 && pFlatMapValue != nullptr
+        && *pFlatMapValue == 89 && (*flatMap.begin()).key == 0)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'FlatMap' end" << std::endl;
+
+    //
+    // SparseSet
+    //
+    std::cout << "Test 'SparseSet' start." << std::endl;
+    SparseSet<F32> sparseSet;
+    sparseSet.Add(3, 0.5f);
+    sparseSet.Add(70000, 1.5f);
+    sparseSet.Add(12, 2.5f);
+    sparseSet.Remove(3);
+    F32 sparseSetSum = 0.0f;
+    for (auto value : sparseSet)
+        sparseSetSum += value;
+    if (sparseSet.Count() == 2 && !sparseSet.Contains(3)
+        && sparseSetSum == 4.0f)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'SparseSet' end" << std::endl;
+
+    //
+    // Queue
+    //
+    std::cout << "Test 'Queue' start." << std::endl;
+    SpscRingBuffer<U32> spscQueue(3);
+    MpmcQueue<U32>      mpmcQueue(3);
+    for (U32 i = 0; i < 4; i++)
+    {
+        spscQueue.TryPush(i);
+        mpmcQueue.TryPush(i);
+    }
+    U32 spscValue = 0, mpmcValue = 0;
+    if (!spscQueue.TryPush((U32) 4) && !mpmcQueue.TryPush((U32) 4)
+        && spscQueue.TryPop(spscValue) && mpmcQueue.TryPop(mpmcValue)
+        && spscValue == 0 && mpmcValue == 0)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Queue' end" << std::endl;
+
+    //
+    // ConcurrentQueue
+    //
+    std::cout << "Test 'ConcurrentQueue' start." << std::endl;
+    constexpr U32 QUEUE_THREAD_COUNT = 4;
+    constexpr U32 QUEUE_VALUE_COUNT  = 10000;
+    MpmcQueue<U32>        mpmcSharedQueue(64);
+    std::atomic<U64>      mpmcSum(0);
+    std::atomic<U32>      mpmcPopCount(0);
+    Array<std::thread>    queueThreads;
+    for (U32 t = 0; t < QUEUE_THREAD_COUNT; t++)
+    {
+        queueThreads.Add(std::thread(
+            [&mpmcSharedQueue, t]()
+            {
+                for (U32 i = 0; i < QUEUE_VALUE_COUNT; i++)
+                {
+                    while (!mpmcSharedQueue.TryPush(
+                        t * QUEUE_VALUE_COUNT + i + 1))
+                        std::this_thread::yield();
+                }
+            }));
+        queueThreads.Add(std::thread(
+            [&mpmcSharedQueue, &mpmcSum, &mpmcPopCount]()
+            {
+                U32 value = 0;
+                while (mpmcPopCount.load() < QUEUE_THREAD_COUNT * QUEUE_VALUE_COUNT)
+                {
+                    if (mpmcSharedQueue.TryPop(value))
+                    {
+                        mpmcSum.fetch_add(value);
+                        mpmcPopCount.fetch_add(1);
+                    }
+                    else
+                        std::this_thread::yield();
+                }
+            }));
+    }
+    for (auto &thread : queueThreads)
+        thread.join();
+    SpscRingBuffer<U32> spscSharedQueue(64);
+    Bool                isSpscOrdered = true;
+    std::thread         spscProducer(
+        [&spscSharedQueue]()
+        {
+            for (U32 i = 0; i < QUEUE_VALUE_COUNT; i++)
+            {
+                while (!spscSharedQueue.TryPush(i))
+                    std::this_thread::yield();
+            }
+        });
+    for (U32 i = 0; i < QUEUE_VALUE_COUNT; i++)
+    {
+        U32 value = 0;
+        while (!spscSharedQueue.TryPop(value))
+            std::this_thread::yield();
+        if (value != i)
+            isSpscOrdered = false;
+    }
+    spscProducer.join();
+    constexpr U64 MPMC_VALUE_TOTAL = (U64) QUEUE_THREAD_COUNT * QUEUE_VALUE_COUNT;
+    if (mpmcSum.load() == MPMC_VALUE_TOTAL * (MPMC_VALUE_TOTAL + 1) / 2
+        && mpmcPopCount.load() == MPMC_VALUE_TOTAL && isSpscOrdered
+        && spscSharedQueue.Count() == 0)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'ConcurrentQueue' end" << std::endl;
+
+    //
+    // BitArray
+    //
+    std::cout << "Test 'BitArray' start." << std::endl;
+    BitArray<> bitArray(200);
+    BitSet<100> bitSet;
+    bitArray.SetRange(60, 130);
+    bitArray.Reset(64);
+    bitSet.Set(3);
+    bitSet.Set(99);
+    if (bitArray.PopCount() == 69 && bitArray.FindFirstSet(64) == 65
+        && bitArray.FindFirstSet(130) == USIZE_MAX && bitSet.PopCount() == 2
+        && bitSet.FindFirstSet(4) == 99)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'BitArray' end" << std::endl;
+
+    //
+    // PriorityQueue
+    //
+    std::cout << "Test 'PriorityQueue' start." << std::endl;
+    PriorityQueue<U32>        priorityQueue;
+    IndexedPriorityQueue<F32> indexedQueue;
+    for (U32 i = 0; i < 10; i++)
+    {
+        priorityQueue.Push((i * 7) % 10);
+        indexedQueue.Push(i, (F32) i);
+    }
+    indexedQueue.Update(8, -1.0f);
+    indexedQueue.Remove(0);
+    U32 priorityValue = 0, indexedKey = 0;
+    priorityQueue.TryPop(priorityValue);
+    indexedQueue.TryPop(indexedKey);
+    if (priorityValue == 0 && priorityQueue.Top() == 1 && indexedKey == 8
+        && indexedQueue.TopKey() == 1 && indexedQueue.Count() == 8)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'PriorityQueue' end" << std::endl;
+
+    //
+    // Intrusive
+    //
+    std::cout << "Test 'Intrusive' start." << std::endl;
+    IntrusiveTestObject intrusiveObjects[4];
+    IntrusiveList<IntrusiveTestObject, &IntrusiveTestObject::listHook>
+        intrusiveList;
+    IntrusiveHashTable<U32,
+                       IntrusiveTestObject,
+                       &IntrusiveTestObject::id,
+                       &IntrusiveTestObject::hashHook>
+        intrusiveTable;
+    for (U32 i = 0; i < 4; i++)
+    {
+        intrusiveObjects[i].id = i * 10;
+        intrusiveList.PushBack(intrusiveObjects[i]);
+        intrusiveTable.Add(intrusiveObjects[i]);
+    }
+    intrusiveList.MoveToFront(intrusiveObjects[2]);
+    intrusiveTable.Remove((U32) 10);
+    if (intrusiveList.Front().id == 20 && intrusiveList.Back().id == 30
+        && intrusiveTable.Find(30) == &intrusiveObjects[3]
+        && !intrusiveTable.Contains(10) && intrusiveTable.Count() == 3)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    intrusiveTable.Clear();
+    intrusiveList.Clear();
+    std::cout << "Test 'Intrusive' end" << std::endl;
+
+    //
+    // Span
+    //
+    std::cout << "Test 'Span' start." << std::endl;
+    Array<U32>       spanArray = {1, 2, 3, 4, 5, 6};
+    Span<U32>        span(spanArray);
+    ConstSpan<U32>   constSpan = span.Slice(2, 3);
+    StridedSpan<U32> stridedSpan(spanArray.Data() + 1, 3, sizeof(U32) * 2);
+    U32 spanSum = 0, stridedSum = 0;
+    for (auto value : constSpan)
+        spanSum += value;
+    for (auto value : stridedSpan)
+        stridedSum += value;
+    auto stridedTail  = stridedSpan.Slice(stridedSpan.Count(), 0);
+    auto stridedEmpty = StridedSpan<U32>().Slice(0, 0);
+    if (span.Count() == 6 && spanSum == 12 && stridedSum == 12
+        && span.Last(1)[0] == 6 && span.Slice(6).IsEmpty()
+        && stridedTail.IsEmpty() && stridedEmpty.IsEmpty()
+        && stridedSpan.Step(2).Count() == 2)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Span' end" << std::endl;
+
+    //
+    // String
+    //
+    std::cout << "Test 'String' start." << std::endl;
+    String shortString(TXT("Furai"));
+    String longString = shortString + TXT("Engine/Assets/Textures/");
+    longString += shortString;
+    if (shortString.Capacity() == String::LOCAL_CAPACITY
+        && longString.Count() == 33
+        && longString.Find(TXT("Assets")) == 12
+        && longString.View().EndsWith(TXT("/Furai")))
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'String' end" << std::endl;
+
+    //
+    // Name
+    //
+    std::cout << "Test 'Name' start." << std::endl;
+    Name literalName = FURAIENGINE_NAME(TXT("Player"));
+    Name runtimeName(String(TXT("Player")).View());
+    Name otherName(StringView(TXT("Enemy")));
+    if (literalName == runtimeName && literalName != otherName
+        && runtimeName.Text() == StringView(TXT("Player"))
+        && Name().IsNone())
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Name' end" << std::endl;
+
+    //
+    // Unicode
+    //
+    std::cout << "Test 'Unicode' start." << std::endl;
+    String unicodeText(TXT("Furai/\xE9\xA2\xA8\xE9\x9B\xB7/\xF0\x9F\x8C\x80/Engine"));
+    U16    utf16[32];
+    Char   utf8[96];
+    USize  utf16Count = 0;
+    USize  utf8Count  = 0;
+    if (IsValidUtf8(unicodeText.Data(), unicodeText.Count())
+        && !IsValidUtf8(TXT("\xC0\xAF"), 2)
+        && ConvertUtf8ToUtf16(unicodeText.Data(), unicodeText.Count(), utf16)
+               .IsSuccess(utf16Count)
+        && utf16Count == 18
+        && ConvertUtf16ToUtf8(utf16, utf16Count, utf8).IsSuccess(utf8Count)
+        && StringView(utf8, utf8Count) == unicodeText.View()
+        && FindCodePoint(unicodeText.Data(), unicodeText.Count(), 0x96F7) == 9
+        && unicodeText.Find(TXT("Engine")) == 18)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Unicode' end" << std::endl;
+
+    //
+    // Sort
+    //
+    std::cout << "Test 'Sort' start." << std::endl;
+    Array<U64> sortKeys;
+    for (U64 i = 0; i < 100000; i++)
+        sortKeys.Add((i * 0x9E3779B97F4A7C15ULL) >> 16);
+    Array<U64> radixKeys    = sortKeys;
+    Array<U64> parallelKeys = sortKeys;
+    Array<F32> depths;
+    for (I32 i = 0; i < 100; i++)
+        depths.Add((F32) ((i * 37) % 100 - 50) * 0.5f);
+    Sort(sortKeys);
+    RadixSort(radixKeys);
+    ParallelRadixSort(parallelKeys, _Internal::RadixIdentity(), 4);
+    StableSort(depths, Greater<F32>());
+    Bool isSorted = true;
+    for (USize i = 1; i < sortKeys.Count(); i++)
+    {
+        if (sortKeys[i - 1] > sortKeys[i] || radixKeys[i] != sortKeys[i]
+            || parallelKeys[i] != sortKeys[i])
+            isSorted = false;
+    }
+    for (USize i = 1; i < depths.Count(); i++)
+    {
+        if (depths[i - 1] < depths[i])
+            isSorted = false;
+    }
+    if (isSorted)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'Sort' end" << std::endl;
+
+    //
+    // PersistentArray
+    //
+    std::cout << "Test 'PersistentArray' start." << std::endl;
+    PersistentArray<U32> frames;
+    for (U32 i = 0; i < 5000; i++)
+        frames.Add(i);
+    PersistentArray<U32> snapshot = frames;
+    frames.Set(10, 0);
+    frames.RemoveLast();
+    frames.Add(7);
+    U32 framesSum = 0;
+    for (auto frame : snapshot)
+        framesSum += frame;
+    if (snapshot.Count() == 5000 && snapshot[10] == 10
+        && snapshot[4999] == 4999 && frames[10] == 0 && frames[4999] == 7
+        && framesSum == 4999 * 5000 / 2)
+        std::cout << "Test is successed." << std::endl;
+    else
+        std::cout << "Test is failed." << std::endl;
+    std::cout << "Test 'PersistentArray' end" << std::endl;
+
     std::cout << "Test end" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,745 @@
+// Unicode.cpp
+// (C) 2022 FuraiEngineCommunity.
+// author Taichi Ito.
+
+#include <cstring>
+#include "FuraiEngine/Bit.hpp"
+#include "FuraiEngine/Unicode.hpp"
+#if defined(FURAIENGINE_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(FURAIENGINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(FURAIENGINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+using namespace FuraiEngine;
+
+// --------------------
+//
+// スカラー処理
+//
+// ====================
+
+// UTF-8の1文字を復号します。
+// pBytes 文字の先頭です。
+// rest 残りのバイト数です。
+// codePoint 復号したコードポイントを受け取る参照です。
+// 文字のバイト数を返します。不正な場合、0です。
+USize DecodeUtf8(const U8 *pBytes, USize rest, U32 &codePoint) noexcept
+{
+    auto lead = pBytes[0];
+    if (lead < 0x80)
+    {
+        codePoint = lead;
+        return 1;
+    }
+    if (lead < 0xC2) // 継続バイト、または、冗長な2バイト表現です。
+        return 0;
+    if (lead < 0xE0)
+    {
+        if (rest < 2 || (pBytes[1] & 0xC0) != 0x80)
+            return 0;
+        codePoint = ((U32) (lead & 0x1F) << 6) | (pBytes[1] & 0x3F);
+        return 2;
+    }
+    if (lead < 0xF0)
+    {
+        if (rest < 3 || (pBytes[1] & 0xC0) != 0x80
+            || (pBytes[2] & 0xC0) != 0x80)
+            return 0;
+        codePoint = ((U32) (lead & 0x0F) << 12)
+                  | ((U32) (pBytes[1] & 0x3F) << 6) | (pBytes[2] & 0x3F);
+        if (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            return 0;
+        return 3;
+    }
+    if (lead < 0xF5)
+    {
+        if (rest < 4 || (pBytes[1] & 0xC0) != 0x80
+            || (pBytes[2] & 0xC0) != 0x80 || (pBytes[3] & 0xC0) != 0x80)
+            return 0;
+        codePoint = ((U32) (lead & 0x07) << 18)
+                  | ((U32) (pBytes[1] & 0x3F) << 12)
+                  | ((U32) (pBytes[2] & 0x3F) << 6) | (pBytes[3] & 0x3F);
+        if (codePoint < 0x10000 || codePoint > 0x10FFFF)
+            return 0;
+        return 4;
+    }
+    return 0;
+}
+
+// コードポイントをUTF-8に符号化します。
+// codePoint コードポイントです。
+// pBytes 書き込み先です。4バイト以上の容量が必要です。
+// 書き込んだバイト数を返します。不正なコードポイントの場合、0です。
+USize EncodeUtf8(U32 codePoint, U8 *pBytes) noexcept
+{
+    if (codePoint < 0x80)
+    {
+        pBytes[0] = (U8) codePoint;
+        return 1;
+    }
+    if (codePoint < 0x800)
+    {
+        pBytes[0] = (U8) (0xC0 | (codePoint >> 6));
+        pBytes[1] = (U8) (0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000)
+    {
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+            return 0;
+        pBytes[0] = (U8) (0xE0 | (codePoint >> 12));
+        pBytes[1] = (U8) (0x80 | ((codePoint >> 6) & 0x3F));
+        pBytes[2] = (U8) (0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    if (codePoint <= 0x10FFFF)
+    {
+        pBytes[0] = (U8) (0xF0 | (codePoint >> 18));
+        pBytes[1] = (U8) (0x80 | ((codePoint >> 12) & 0x3F));
+        pBytes[2] = (U8) (0x80 | ((codePoint >> 6) & 0x3F));
+        pBytes[3] = (U8) (0x80 | (codePoint & 0x3F));
+        return 4;
+    }
+    return 0;
+}
+
+// 先頭から連続するASCII文字のバイト数を、ブロック単位で数えます。
+// 末尾の8バイト未満は数えません。
+// pBytes 先頭です。
+// count バイト数です。
+USize CountAsciiBlocks(const U8 *pBytes, USize count) noexcept
+{
+    USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+    for (; i + 16 <= count; i += 16)
+    {
+        auto block = _mm_loadu_si128((const __m128i *) (pBytes + i));
+        if (_mm_movemask_epi8(block) != 0)
+            break;
+    }
+#elif defined(FURAIENGINE_SIMD_NEON64)
+    for (; i + 16 <= count; i += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(pBytes + i)) >= 0x80)
+            break;
+    }
+#endif
+    for (; i + 8 <= count; i += 8)
+    {
+        U64 word;
+        std::memcpy(&word, pBytes + i, sizeof(U64));
+        if ((word & 0x8080808080808080ULL) != 0)
+            break;
+    }
+    return i;
+}
+
+// ASCII文字列を16ビットに拡張して書き込みます。
+// pBytes ASCII文字列です。
+// count バイト数です。
+// pDestination 書き込み先です。
+void WidenAscii(const U8 *pBytes, USize count, U16 *pDestination) noexcept
+{
+    USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+    auto zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        auto block = _mm_loadu_si128((const __m128i *) (pBytes + i));
+        _mm_storeu_si128((__m128i *) (pDestination + i),
+                         _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128((__m128i *) (pDestination + i + 8),
+                         _mm_unpackhi_epi8(block, zero));
+    }
+#elif defined(FURAIENGINE_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        auto block = vld1q_u8(pBytes + i);
+        vst1q_u16(pDestination + i, vmovl_u8(vget_low_u8(block)));
+        vst1q_u16(pDestination + i + 8, vmovl_u8(vget_high_u8(block)));
+    }
+#endif
+    for (; i < count; i++)
+        pDestination[i] = pBytes[i];
+}
+
+// ASCII文字列を32ビットに拡張して書き込みます。
+// pBytes ASCII文字列です。
+// count バイト数です。
+// pDestination 書き込み先です。
+void WidenAscii(const U8 *pBytes, USize count, U32 *pDestination) noexcept
+{
+    USize i = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+    auto zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        auto block = _mm_loadu_si128((const __m128i *) (pBytes + i));
+        auto low   = _mm_unpacklo_epi8(block, zero);
+        auto high  = _mm_unpackhi_epi8(block, zero);
+        _mm_storeu_si128((__m128i *) (pDestination + i),
+                         _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i *) (pDestination + i + 4),
+                         _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i *) (pDestination + i + 8),
+                         _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i *) (pDestination + i + 12),
+                         _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(FURAIENGINE_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        auto block = vld1q_u8(pBytes + i);
+        auto low   = vmovl_u8(vget_low_u8(block));
+        auto high  = vmovl_u8(vget_high_u8(block));
+        vst1q_u32(pDestination + i, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(pDestination + i + 4, vmovl_u16(vget_high_u16(low)));
+        vst1q_u32(pDestination + i + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(pDestination + i + 12, vmovl_u16(vget_high_u16(high)));
+    }
+#endif
+    for (; i < count; i++)
+        pDestination[i] = pBytes[i];
+}
+
+// UTF-8をスカラー処理で検証します。
+// pBytes 先頭です。
+// count バイト数です。
+Bool IsValidUtf8Scalar(const U8 *pBytes, USize count) noexcept
+{
+    USize i = 0;
+    while (i < count)
+    {
+        i += CountAsciiBlocks(pBytes + i, count - i);
+        if (i >= count)
+            break;
+        U32  codePoint = 0;
+        auto length    = DecodeUtf8(pBytes + i, count - i, codePoint);
+        if (length == 0)
+            return false;
+        i += length;
+    }
+    return true;
+}
+
+// --------------------
+//
+// ベクトル処理による検証
+//
+// ====================
+
+// 16バイトずつ、前のブロックの末尾3バイトと合わせて表引きで検証します。
+// 上位ニブルと下位ニブルごとの表で、2バイトの組に現れうる誤りをビットの集合として求め、
+// 3、4バイト目の継続バイトの過不足を別途判定します。
+
+constexpr U8 UTF8_TOO_SHORT      = 1 << 0; // 先行バイトの後に継続バイトがありません。
+constexpr U8 UTF8_TOO_LONG       = 1 << 1; // ASCIIの後に継続バイトがあります。
+constexpr U8 UTF8_OVERLONG_3     = 1 << 2; // 冗長な3バイト表現です。
+constexpr U8 UTF8_TOO_LARGE      = 1 << 3; // U+10FFFFを超えます。
+constexpr U8 UTF8_SURROGATE      = 1 << 4; // サロゲートです。
+constexpr U8 UTF8_OVERLONG_2     = 1 << 5; // 冗長な2バイト表現です。
+constexpr U8 UTF8_TOO_LARGE_1000 = 1 << 6; // U+10FFFFを超えます。(F4 90以降)
+constexpr U8 UTF8_OVERLONG_4     = 1 << 6; // 冗長な4バイト表現です。
+constexpr U8 UTF8_TWO_CONTS      = 1 << 7; // 継続バイトが2つ続きます。
+constexpr U8 UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+// 1バイト目の上位ニブルの表です。
+constexpr U8 UTF8_BYTE_1_HIGH[16] = {
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+// 1バイト目の下位ニブルの表です。
+constexpr U8 UTF8_BYTE_1_LOW[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+// 2バイト目の上位ニブルの表です。
+constexpr U8 UTF8_BYTE_2_HIGH[16] = {
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3
+        | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3
+        | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE
+        | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE
+        | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+};
+
+// ブロック末尾で途切れうる先行バイトの上限です。(これを超える値が途切れています)
+constexpr U8 UTF8_INCOMPLETE_MAX[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+#if defined(FURAIENGINE_SIMD_SSSE3)
+// UTF-8をSSSE3で検証します。
+// pBytes 先頭です。
+// count バイト数です。
+Bool IsValidUtf8Vector(const U8 *pBytes, USize count) noexcept
+{
+    const auto byte1High  = _mm_loadu_si128((const __m128i *) UTF8_BYTE_1_HIGH);
+    const auto byte1Low   = _mm_loadu_si128((const __m128i *) UTF8_BYTE_1_LOW);
+    const auto byte2High  = _mm_loadu_si128((const __m128i *) UTF8_BYTE_2_HIGH);
+    const auto maxValue   = _mm_loadu_si128((const __m128i *) UTF8_INCOMPLETE_MAX);
+    const auto nibbleMask = _mm_set1_epi8(0x0F);
+    const auto thirdMin   = _mm_set1_epi8((char) (0xE0 - 0x80));
+    const auto fourthMin  = _mm_set1_epi8((char) (0xF0 - 0x80));
+    const auto highBit    = _mm_set1_epi8((char) 0x80);
+
+    auto error              = _mm_setzero_si128();
+    auto previousInput      = _mm_setzero_si128();
+    auto previousIncomplete = _mm_setzero_si128();
+    auto check              = [&](__m128i input) noexcept {
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            // ASCIIのみのブロックは、前のブロックが途切れていないかだけを確認します。
+            error = _mm_or_si128(error, previousIncomplete);
+        }
+        else
+        {
+            auto prev1   = _mm_alignr_epi8(input, previousInput, 15);
+            auto special = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8(
+                        byte1High,
+                        _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask)),
+                    _mm_shuffle_epi8(byte1Low,
+                                     _mm_and_si128(prev1, nibbleMask))),
+                _mm_shuffle_epi8(
+                    byte2High,
+                    _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask)));
+            auto prev2  = _mm_alignr_epi8(input, previousInput, 14);
+            auto prev3  = _mm_alignr_epi8(input, previousInput, 13);
+            auto must23 = _mm_and_si128(
+                _mm_or_si128(_mm_subs_epu8(prev2, thirdMin),
+                             _mm_subs_epu8(prev3, fourthMin)),
+                highBit);
+            error = _mm_or_si128(error, _mm_xor_si128(must23, special));
+            previousIncomplete = _mm_subs_epu8(input, maxValue);
+        }
+        previousInput = input;
+    };
+
+    USize i = 0;
+    for (; i + 16 <= count; i += 16)
+        check(_mm_loadu_si128((const __m128i *) (pBytes + i)));
+    // 末尾は0で埋めたブロックとして検証し、途切れたバイト列も検出します。
+    alignas(16) U8 tail[16] = {};
+    if (i < count)
+        std::memcpy(tail, pBytes + i, count - i);
+    check(_mm_load_si128((const __m128i *) tail));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128()))
+        == 0xFFFF;
+}
+#elif defined(FURAIENGINE_SIMD_NEON64)
+// UTF-8をNEONで検証します。
+// pBytes 先頭です。
+// count バイト数です。
+Bool IsValidUtf8Vector(const U8 *pBytes, USize count) noexcept
+{
+    const auto byte1High  = vld1q_u8(UTF8_BYTE_1_HIGH);
+    const auto byte1Low   = vld1q_u8(UTF8_BYTE_1_LOW);
+    const auto byte2High  = vld1q_u8(UTF8_BYTE_2_HIGH);
+    const auto maxValue   = vld1q_u8(UTF8_INCOMPLETE_MAX);
+    const auto nibbleMask = vdupq_n_u8(0x0F);
+    const auto thirdMin   = vdupq_n_u8(0xE0 - 0x80);
+    const auto fourthMin  = vdupq_n_u8(0xF0 - 0x80);
+    const auto highBit    = vdupq_n_u8(0x80);
+
+    auto error              = vdupq_n_u8(0);
+    auto previousInput      = vdupq_n_u8(0);
+    auto previousIncomplete = vdupq_n_u8(0);
+    auto check              = [&](uint8x16_t input) noexcept {
+        if (vmaxvq_u8(input) < 0x80)
+        {
+            // ASCIIのみのブロックは、前のブロックが途切れていないかだけを確認します。
+            error = vorrq_u8(error, previousIncomplete);
+        }
+        else
+        {
+            auto prev1   = vextq_u8(previousInput, input, 15);
+            auto special = vandq_u8(
+                vandq_u8(vqtbl1q_u8(byte1High, vshrq_n_u8(prev1, 4)),
+                         vqtbl1q_u8(byte1Low, vandq_u8(prev1, nibbleMask))),
+                vqtbl1q_u8(byte2High, vshrq_n_u8(input, 4)));
+            auto prev2  = vextq_u8(previousInput, input, 14);
+            auto prev3  = vextq_u8(previousInput, input, 13);
+            auto must23 = vandq_u8(vorrq_u8(vqsubq_u8(prev2, thirdMin),
+                                            vqsubq_u8(prev3, fourthMin)),
+                                   highBit);
+            error = vorrq_u8(error, veorq_u8(must23, special));
+            previousIncomplete = vqsubq_u8(input, maxValue);
+        }
+        previousInput = input;
+    };
+
+    USize i = 0;
+    for (; i + 16 <= count; i += 16)
+        check(vld1q_u8(pBytes + i));
+    // 末尾は0で埋めたブロックとして検証し、途切れたバイト列も検出します。
+    alignas(16) U8 tail[16] = {};
+    if (i < count)
+        std::memcpy(tail, pBytes + i, count - i);
+    check(vld1q_u8(tail));
+    return vmaxvq_u8(error) == 0;
+}
+#endif
+
+// --------------------
+//
+// 検証
+//
+// ====================
+
+// UTF-8として正しいか検証します。
+// 冗長な表現、サロゲート、U+10FFFFを超える値、途切れたバイト列を不正とします。
+// pText 文字列の先頭です。
+// count バイト数です。
+Bool FuraiEngine::IsValidUtf8(const Char *pText, USize count) noexcept
+{
+#if defined(FURAIENGINE_SIMD_SSSE3) || defined(FURAIENGINE_SIMD_NEON64)
+    return IsValidUtf8Vector((const U8 *) pText, count);
+#else
+    return IsValidUtf8Scalar((const U8 *) pText, count);
+#endif
+}
+
+// --------------------
+//
+// 変換
+//
+// ====================
+
+// UTF-8をUTF-16に変換します。
+// pSource 変換元の先頭です。
+// count 変換元のバイト数です。
+// pDestination 変換先です。count要素以上の容量が必要です。
+Result<USize, EUnicodeError> FuraiEngine::ConvertUtf8ToUtf16(
+    const Char *pSource,
+    USize       count,
+    U16        *pDestination) noexcept
+{
+    auto  pBytes  = (const U8 *) pSource;
+    USize i       = 0;
+    USize written = 0;
+    while (i < count)
+    {
+        auto ascii = CountAsciiBlocks(pBytes + i, count - i);
+        WidenAscii(pBytes + i, ascii, pDestination + written);
+        i += ascii;
+        written += ascii;
+        // 次のASCIIブロックの判定までは1文字ずつ復号します。
+        while (i < count)
+        {
+            U32  codePoint = 0;
+            auto length    = DecodeUtf8(pBytes + i, count - i, codePoint);
+            if (length == 0)
+                return EUnicodeError::INVALID_SEQUENCE;
+            if (codePoint < 0x10000)
+            {
+                pDestination[written++] = (U16) codePoint;
+            }
+            else
+            {
+                codePoint -= 0x10000;
+                pDestination[written++] = (U16) (0xD800 | (codePoint >> 10));
+                pDestination[written++] = (U16) (0xDC00 | (codePoint & 0x3FF));
+            }
+            i += length;
+            if (length == 1)
+                break;
+        }
+    }
+    return (USize) written;
+}
+
+// UTF-8をUTF-32に変換します。
+// pSource 変換元の先頭です。
+// count 変換元のバイト数です。
+// pDestination 変換先です。count要素以上の容量が必要です。
+Result<USize, EUnicodeError> FuraiEngine::ConvertUtf8ToUtf32(
+    const Char *pSource,
+    USize       count,
+    U32        *pDestination) noexcept
+{
+    auto  pBytes  = (const U8 *) pSource;
+    USize i       = 0;
+    USize written = 0;
+    while (i < count)
+    {
+        auto ascii = CountAsciiBlocks(pBytes + i, count - i);
+        WidenAscii(pBytes + i, ascii, pDestination + written);
+        i += ascii;
+        written += ascii;
+        // 次のASCIIブロックの判定までは1文字ずつ復号します。
+        while (i < count)
+        {
+            U32  codePoint = 0;
+            auto length    = DecodeUtf8(pBytes + i, count - i, codePoint);
+            if (length == 0)
+                return EUnicodeError::INVALID_SEQUENCE;
+            pDestination[written++] = codePoint;
+            i += length;
+            if (length == 1)
+                break;
+        }
+    }
+    return (USize) written;
+}
+
+// UTF-16をUTF-8に変換します。
+// pSource 変換元の先頭です。
+// count 変換元の要素数です。
+// pDestination 変換先です。count * 3バイト以上の容量が必要です。
+Result<USize, EUnicodeError> FuraiEngine::ConvertUtf16ToUtf8(
+    const U16 *pSource,
+    USize      count,
+    Char      *pDestination) noexcept
+{
+    auto  pBytes  = (U8 *) pDestination;
+    USize i       = 0;
+    USize written = 0;
+    while (i < count)
+    {
+#if defined(FURAIENGINE_SIMD_SSE2)
+        // 8要素がすべてASCIIの場合、まとめて詰めます。
+        const auto asciiMask = _mm_set1_epi16((short) 0xFF80);
+        while (i + 8 <= count)
+        {
+            auto block = _mm_loadu_si128((const __m128i *) (pSource + i));
+            auto high  = _mm_and_si128(block, asciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128()))
+                != 0xFFFF)
+                break;
+            _mm_storel_epi64((__m128i *) (pBytes + written),
+                             _mm_packus_epi16(block, block));
+            i += 8;
+            written += 8;
+        }
+#elif defined(FURAIENGINE_SIMD_NEON64)
+        // 8要素がすべてASCIIの場合、まとめて詰めます。
+        while (i + 8 <= count)
+        {
+            auto block = vld1q_u16(pSource + i);
+            if (vmaxvq_u16(block) >= 0x80)
+                break;
+            vst1_u8(pBytes + written, vmovn_u16(block));
+            i += 8;
+            written += 8;
+        }
+#endif
+        if (i >= count)
+            break;
+        U32 codePoint = pSource[i];
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+        {
+            if (i + 1 >= count || pSource[i + 1] < 0xDC00
+                || pSource[i + 1] > 0xDFFF)
+                return EUnicodeError::INVALID_SEQUENCE;
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10)
+                      + (pSource[i + 1] - 0xDC00);
+            i += 2;
+        }
+        else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+        {
+            return EUnicodeError::INVALID_SEQUENCE;
+        }
+        else
+        {
+            i += 1;
+        }
+        written += EncodeUtf8(codePoint, pBytes + written);
+    }
+    return (USize) written;
+}
+
+// UTF-32をUTF-8に変換します。
+// pSource 変換元の先頭です。
+// count 変換元の要素数です。
+// pDestination 変換先です。count * 4バイト以上の容量が必要です。
+Result<USize, EUnicodeError> FuraiEngine::ConvertUtf32ToUtf8(
+    const U32 *pSource,
+    USize      count,
+    Char      *pDestination) noexcept
+{
+    auto  pBytes  = (U8 *) pDestination;
+    USize i       = 0;
+    USize written = 0;
+    while (i < count)
+    {
+#if defined(FURAIENGINE_SIMD_SSE2)
+        // 8要素がすべてASCIIの場合、まとめて詰めます。
+        const auto asciiMask = _mm_set1_epi32((int) 0xFFFFFF80);
+        while (i + 8 <= count)
+        {
+            auto low  = _mm_loadu_si128((const __m128i *) (pSource + i));
+            auto high = _mm_loadu_si128((const __m128i *) (pSource + i + 4));
+            auto bits = _mm_and_si128(_mm_or_si128(low, high), asciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(bits, _mm_setzero_si128()))
+                != 0xFFFF)
+                break;
+            auto packed = _mm_packs_epi32(low, high);
+            _mm_storel_epi64((__m128i *) (pBytes + written),
+                             _mm_packus_epi16(packed, packed));
+            i += 8;
+            written += 8;
+        }
+#endif
+        if (i >= count)
+            break;
+        auto length = EncodeUtf8(pSource[i], pBytes + written);
+        if (length == 0)
+            return EUnicodeError::INVALID_CODE_POINT;
+        written += length;
+        i += 1;
+    }
+    return (USize) written;
+}
+
+// --------------------
+//
+// 検索
+//
+// ====================
+
+// 部分文字列を検索します。
+// 先頭と末尾のバイトが一致する位置をベクトル命令でまとめて求め、その位置だけを比較します。
+// pText 検索対象の先頭です。
+// count 検索対象のバイト数です。
+// pPattern 検索する文字列の先頭です。
+// patternCount 検索する文字列のバイト数です。
+USize FuraiEngine::FindText(const Char *pText,
+                            USize       count,
+                            const Char *pPattern,
+                            USize       patternCount) noexcept
+{
+    if (patternCount == 0)
+        return 0;
+    if (patternCount > count)
+        return USIZE_MAX;
+    if (patternCount == 1)
+    {
+        auto pFound = (const Char *) std::memchr(pText, (int) pPattern[0], count);
+        return pFound != nullptr ? (USize) (pFound - pText) : USIZE_MAX;
+    }
+    auto  pBytes   = (const U8 *) pText;
+    auto  pNeedle  = (const U8 *) pPattern;
+    auto  lastStep = patternCount - 1;
+    auto  last     = count - patternCount; // 一致しうる最後の位置です。
+    USize i        = 0;
+#if defined(FURAIENGINE_SIMD_SSE2)
+    const auto first = _mm_set1_epi8((char) pNeedle[0]);
+    const auto tail  = _mm_set1_epi8((char) pNeedle[lastStep]);
+    for (; i + 16 <= last + 1; i += 16)
+    {
+        auto blockFirst =
+            _mm_loadu_si128((const __m128i *) (pBytes + i));
+        auto blockLast =
+            _mm_loadu_si128((const __m128i *) (pBytes + i + lastStep));
+        auto mask = (U32) _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first),
+                          _mm_cmpeq_epi8(blockLast, tail)));
+        while (mask != 0)
+        {
+            auto offset = (USize) CountTrailingZeros(mask);
+            if (std::memcmp(pBytes + i + offset + 1,
+                            pNeedle + 1,
+                            patternCount - 2)
+                == 0)
+                return i + offset;
+            mask &= mask - 1;
+        }
+    }
+#elif defined(FURAIENGINE_SIMD_NEON)
+    const auto first = vdupq_n_u8(pNeedle[0]);
+    const auto tail  = vdupq_n_u8(pNeedle[lastStep]);
+    for (; i + 16 <= last + 1; i += 16)
+    {
+        auto equal = vandq_u8(vceqq_u8(vld1q_u8(pBytes + i), first),
+                              vceqq_u8(vld1q_u8(pBytes + i + lastStep), tail));
+        // 1バイトあたり4ビットのマスクに縮めます。
+        auto mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)),
+            0);
+        mask &= 0x1111111111111111ULL;
+        while (mask != 0)
+        {
+            auto offset = (USize) CountTrailingZeros(mask) / 4;
+            if (std::memcmp(pBytes + i + offset + 1,
+                            pNeedle + 1,
+                            patternCount - 2)
+                == 0)
+                return i + offset;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i <= last; i++)
+    {
+        if (pBytes[i] == pNeedle[0] && pBytes[i + lastStep] == pNeedle[lastStep]
+            && std::memcmp(pBytes + i + 1, pNeedle + 1, patternCount - 2) == 0)
+            return i;
+    }
+    return USIZE_MAX;
+}
+
+// 文字を検索します。
+// UTF-8は自己同期的な為、符号化したバイト列の検索で文字の境界と一致します。
+// pText 検索対象の先頭です。UTF-8として正しい必要があります。
+// count 検索対象のバイト数です。
+// codePoint 検索する文字のコードポイントです。
+USize FuraiEngine::FindCodePoint(const Char *pText,
+                                 USize       count,
+                                 U32         codePoint) noexcept
+{
+    U8   pattern[4] = {};
+    auto length     = EncodeUtf8(codePoint, pattern);
+    if (length == 0)
+        return USIZE_MAX;
+    return FindText(pText, count, (const Char *) pattern, length);
+}
\ No newline at end of file
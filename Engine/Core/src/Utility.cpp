@@ -2,41 +2,1193 @@
 // (C) 2022 FuraiEngineCommunity.
 // author Taichi Ito.
 
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
-#include <iostream>
 #include <mutex>
 #include <new>
+#include <thread>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <signal.h>
+#include <unistd.h>
+#endif
+#include "FuraiEngine/LogSink.hpp"
+#include "FuraiEngine/Memory.hpp"
 #include "FuraiEngine/Utility.hpp"
 
 using namespace FuraiEngine;
 using namespace FuraiEngine::_Internal;
 
+// --------------------
+//
+// LogBuffer
+//
+// ====================
+
+// スレッドごとのログバッファです。
+// 記録を可変長のバイト列で保持する単一生産者単一消費者のリングバッファです。
+// 生産者はバッファを所有するスレッド、消費者は書き込みスレッドです。
+class FuraiEngine::_Internal::LogBuffer
+{
+public:
+    static constexpr USize CAPACITY = 64 * 1024;    // 容量です。(2の累乗)
+    static constexpr USize MASK     = CAPACITY - 1; // 位置を容量内に収めるマスクです。
+    static constexpr USize FLIGHT_RECORDS_COUNT  = 64;       // フライトレコーダーに残す記録の数です。
+    static constexpr USize FLIGHT_RECORD_SIZE    = 256;      // フライトレコーダーに残す記録の最大のサイズです。
+    static constexpr U64   FLIGHT_RECORD_INVALID = ~(U64) 0; // 書き込み中、または、未使用の記録の番号です。
+    static constexpr USize SIGNAL_STACK_SIZE     = 32 * 1024; // 致命的なシグナルを処理する代替スタックのサイズです。
+
+    // フライトレコーダーの記録です。
+    struct FlightRecord
+    {
+        std::atomic<U64> index; // 記録の番号です。
+        U8 data[FLIGHT_RECORD_SIZE]; // 先頭から切り出した記録です。
+    };
+
+    // 消費者が更新する値です。
+    alignas(CACHE_LINE_SIZE) std::atomic<USize> m_head; // 次に読み込む位置です。
+    USize m_drainHead; // 書き込み中に次に読み込む位置です。
+    USize m_drainTail; // 書き込みを始めた時点の確定した記録の終端です。
+    U64   m_drainCount; // これまでに読み込んだ記録の数です。
+    U64   m_writtenCount; // 出力先への書き込みを終えた記録の数です。
+
+    // 生産者が更新する値です。
+    alignas(CACHE_LINE_SIZE) std::atomic<USize> m_tail; // 確定した記録の終端です。
+    USize m_cachedHead; // 生産者が最後に読んだ読み込み位置です。
+    std::atomic<Bool> m_isNotifiedF; // 書き込みスレッドを起こした後、まだ読み込まれていないか判定します。
+
+    // 所有権の値です。
+    alignas(CACHE_LINE_SIZE) std::atomic<Bool> m_isUsed; // スレッドが所有しているか判定します。
+    LogBuffer *m_pNext; // 次のバッファです。登録後は変更されません。
+
+    // フライトレコーダーの値です。生産者が更新し、異常終了時に読み込みます。
+    alignas(CACHE_LINE_SIZE) std::atomic<U64> m_flightCount; // これまでに残した記録の数です。
+    FlightRecord m_flightRecords[FLIGHT_RECORDS_COUNT]; // 最新の記録のリングバッファです。
+
+    alignas(CACHE_LINE_SIZE) U8 m_data[CAPACITY]; // 記録のデータです。
+#if !defined(_WIN32)
+    alignas(CACHE_LINE_SIZE) U8 m_signalStack[SIGNAL_STACK_SIZE]; // 所有するスレッドの致命的なシグナルを処理する代替スタックです。
+#endif
+
+    // 初期化します。
+    LogBuffer() noexcept
+        : m_head(0)
+        , m_drainHead(0)
+        , m_drainTail(0)
+        , m_drainCount(0)
+        , m_writtenCount(0)
+        , m_tail(0)
+        , m_cachedHead(0)
+        , m_isNotifiedF(false)
+        , m_isUsed(true)
+        , m_pNext(nullptr)
+        , m_flightCount(0)
+    {
+        for (auto &record : this->m_flightRecords)
+            record.index.store(FLIGHT_RECORD_INVALID, std::memory_order_relaxed);
+    }
+
+    // 書き込む範囲の空きを待機します。
+    // end 書き込む範囲の終端です。
+    // 空いた場合、真です。ログシステムが停止した場合、書き込みスレッドで空きが無い場合、偽です。
+    Bool Reserve(USize end) noexcept;
+
+    // 確定する記録をフライトレコーダーに残します。
+    // 記録の先頭からFLIGHT_RECORD_SIZEまでを残します。
+    // position 記録の位置です。
+    // size 記録のサイズです。
+    void Record(USize position, U32 size) noexcept;
+
+    // データを書き込みます。
+    // position 書き込む位置です。
+    // pData 書き込むデータです。
+    // size 書き込むサイズです。
+    void Store(USize position, const void *pData, USize size) noexcept
+    {
+        auto offset = position & MASK;
+        auto first  = size < CAPACITY - offset ? size : CAPACITY - offset;
+        std::memcpy(&this->m_data[offset], pData, first);
+        std::memcpy(this->m_data, (const U8 *) pData + first, size - first);
+    }
+
+    // データを読み込みます。
+    // position 読み込む位置です。
+    // pData 読み込み先です。
+    // size 読み込むサイズです。
+    void Load(USize position, void *pData, USize size) const noexcept
+    {
+        auto offset = position & MASK;
+        auto first  = size < CAPACITY - offset ? size : CAPACITY - offset;
+        std::memcpy(pData, &this->m_data[offset], first);
+        std::memcpy((U8 *) pData + first, this->m_data, size - first);
+    }
+};
+
 // --------------------
 //
 // ログシステム
 //
 // ====================
 
+// 記録の先頭に置く情報です。
+struct LogRecordHeader
+{
+    U32         size;    // ヘッダを含む記録のサイズです。
+    U64         time;    // 記録した時間です。(単調増加する時計のナノ秒)
+    const Char *pLabel;  // メッセージのカテゴリラベルです。
+    const Char *pFormat; // 書式です。nullptrの場合、本文はメッセージです。
+    const LogCategory *pCategory; // カテゴリです。nullptrの場合、既定のカテゴリです。
+};
+static_assert(sizeof(LogRecordHeader) <= LogBuffer::FLIGHT_RECORD_SIZE,
+              "The flight record must hold the record header.");
+
 const Char *LOG_FILE_NAME = TXT("Log.txt"); // ログファイル名です。
-FILE *g_pFile = nullptr; // ログファイルのポインタです。
-std::mutex g_logMutexF; // ログ書き込みのための占有ロックフラグです。
+constexpr auto LOG_WRITER_INTERVAL = std::chrono::milliseconds(10); // 書き込みスレッドの待機間隔です。
+LogSink *g_pLogSinks[LOG_SINKS_MAX]; // ログの出力先です。
+USize g_logSinksCount = 0; // ログの出力先の数です。
+std::mutex g_logSinksMutexF; // ログの出力先の変更のための占有ロックフラグです。
 std::once_flag g_initializeLogSystemOnceF; // ログシステムの初期化フラグです。
+std::atomic<Bool> g_isLogSystemRunningF(false); // ログシステムが稼働中か判定します。
+std::atomic<LogBuffer *> g_pLogBuffers(nullptr); // 登録されたバッファの単方向連結リストの先頭です。
+std::thread g_logWriter; // 書き込みスレッドです。
+std::mutex g_logWriterMutexF; // 書き込みスレッドの待機のための占有ロックフラグです。
+std::condition_variable g_logWriterCondition; // 書き込みスレッドを起こす条件変数です。
+std::condition_variable g_logFlushedCondition; // 書き込みの完了を通知する条件変数です。
+std::atomic<U64> g_logFlushRequestedCount(0); // 要求された書き込みの回数です。
+U64 g_logFlushedCount = 0; // 完了した書き込みの回数です。
+U8 g_logRecordData[2][LogBuffer::CAPACITY]; // 書き込みスレッドが記録を読み込む領域です。
+U8 *g_pLogRecordData = g_logRecordData[0]; // 次に記録を読み込む領域です。
+U8 *g_pLogLastRecordData = g_logRecordData[1]; // 最後に出力した記録の本文です。
+LogRecordHeader g_logLastRecordHeader; // 最後に出力した記録の先頭の情報です。サイズが0の場合、記録はありません。
+U64 g_logRepeatedCount = 0; // 最後に出力した記録を続けて省略した回数です。
+U64 g_logRepeatedTime = 0; // 最初に省略した記録の時間です。
+constexpr auto LOG_REPEAT_INTERVAL = std::chrono::seconds(1); // 省略した回数を出力する間隔です。
+U64 g_logBaseTime = 0; // 較正した単調増加する時計のナノ秒です。
+std::chrono::system_clock::time_point g_logBaseSystemTime; // 較正した壁時計の時間です。
+std::atomic<Bool> g_isLogDumpingF(false); // フライトレコーダーを出力中か判定します。
+U8 g_logDumpRecordData[LogBuffer::FLIGHT_RECORD_SIZE]; // フライトレコーダーの記録を読み込む領域です。
+constexpr int LOG_DUMP_LOCK_ATTEMPTS = 1000; // フライトレコーダーの出力で出力先のロックを試みる回数です。
+std::atomic<LogRateLimiter *> g_pLogRateLimiters(nullptr); // 破棄した回数を書き込みスレッドが出力するログの出力制限の単方向連結リストの先頭です。
+thread_local Bool t_isLoggingF = false; // このスレッドで記録中か判定します。
+thread_local Bool t_isLogWriterF = false; // このスレッドが書き込みスレッドか判定します。
+thread_local LogBuffer *t_pLogBuffer = nullptr; // このスレッドのバッファです。シグナルハンドラから参照します。
+
+// スレッドが所有するバッファです。
+// スレッドの終了時に所有権を手放し、他のスレッドが再利用します。
+struct LogBufferOwner
+{
+    LogBuffer *pBuffer = nullptr; // 所有するバッファです。
+
+    // 所有権を手放します。
+    ~LogBufferOwner() noexcept
+    {
+        if (this->pBuffer == nullptr)
+            return;
+#if !defined(_WIN32)
+        // 他のスレッドが再利用するため、代替スタックの設定を解除します
+        stack_t current;
+        if (sigaltstack(nullptr, &current) == 0 && current.ss_sp == this->pBuffer->m_signalStack)
+        {
+            stack_t disabled;
+            std::memset(&disabled, 0, sizeof(disabled));
+            disabled.ss_flags = SS_DISABLE;
+            sigaltstack(&disabled, nullptr);
+        }
+#endif
+        t_pLogBuffer = nullptr;
+        this->pBuffer->m_isUsed.store(false, std::memory_order_release);
+    }
+};
+thread_local LogBufferOwner t_logBufferOwner; // このスレッドのバッファです。
+
+// 単調増加する時計の現在の時間を取得します。
+// ナノ秒です。
+U64 NowLogTime()
+{
+    return (U64) std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// 単調増加する時計を壁時計に対して較正します。
+void CalibrateLogTime()
+{
+    g_logBaseSystemTime = std::chrono::system_clock::now();
+    g_logBaseTime       = NowLogTime();
+}
+
+// 書き込みスレッドを起こします。
+void NotifyLogWriter()
+{
+    std::lock_guard<std::mutex> lock(g_logWriterMutexF);
+    g_logWriterCondition.notify_one();
+}
+
+// バッファをこのスレッドの所有にします。
+// スタックの溢れでも致命的なシグナルを処理できるよう、代替スタックが無い場合はバッファの代替スタックを設定します。
+// pBuffer 所有するバッファです。
+// 所有したバッファです。
+LogBuffer *OwnLogBuffer(LogBuffer *pBuffer)
+{
+#if !defined(_WIN32)
+    stack_t current;
+    if (sigaltstack(nullptr, &current) == 0 && (current.ss_flags & SS_DISABLE) != 0)
+    {
+        stack_t stack;
+        std::memset(&stack, 0, sizeof(stack));
+        stack.ss_sp   = pBuffer->m_signalStack;
+        stack.ss_size = LogBuffer::SIGNAL_STACK_SIZE;
+        sigaltstack(&stack, nullptr);
+    }
+#endif
+    t_pLogBuffer = pBuffer;
+    return t_logBufferOwner.pBuffer = pBuffer;
+}
+
+// このスレッドのバッファを取得します。
+// 取得できなかった場合、nullptrです。
+LogBuffer *AcquireLogBuffer()
+{
+    if (t_logBufferOwner.pBuffer != nullptr)
+        return t_logBufferOwner.pBuffer;
+
+    // 終了したスレッドのバッファを再利用します
+    for (auto pBuffer = g_pLogBuffers.load(std::memory_order_acquire);
+         pBuffer != nullptr;
+         pBuffer = pBuffer->m_pNext)
+    {
+        auto isUsed = false;
+        if (pBuffer->m_isUsed.compare_exchange_strong(
+                isUsed, true, std::memory_order_acquire))
+        {
+            pBuffer->m_cachedHead = pBuffer->m_head.load(std::memory_order_acquire);
+            return OwnLogBuffer(pBuffer);
+        }
+    }
+
+    auto pBuffer = new (std::nothrow) LogBuffer();
+    if (pBuffer == nullptr)
+        return nullptr;
+    pBuffer->m_pNext = g_pLogBuffers.load(std::memory_order_relaxed);
+    while (!g_pLogBuffers.compare_exchange_weak(
+        pBuffer->m_pNext, pBuffer, std::memory_order_release))
+    {}
+    return OwnLogBuffer(pBuffer);
+}
+
+// 書き込む範囲の空きを待機します。
+// end 書き込む範囲の終端です。
+// 空いた場合、真です。ログシステムが停止した場合、書き込みスレッドで空きが無い場合、偽です。
+Bool FuraiEngine::_Internal::LogBuffer::Reserve(USize end) noexcept
+{
+    while (end - this->m_cachedHead > CAPACITY)
+    {
+        this->m_cachedHead = this->m_head.load(std::memory_order_acquire);
+        if (end - this->m_cachedHead <= CAPACITY)
+            break;
+        if (!g_isLogSystemRunningF.load(std::memory_order_relaxed))
+            return false;
+        // 書き込みスレッドは自身のバッファを読むまで空かないため、記録を破棄します
+        if (t_isLogWriterF)
+            return false;
+        // 確定済みの記録が読まれるまで待機します
+        NotifyLogWriter();
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+// 確定する記録をフライトレコーダーに残します。
+// 記録の先頭からFLIGHT_RECORD_SIZEまでを残します。
+// position 記録の位置です。
+// size 記録のサイズです。
+void FuraiEngine::_Internal::LogBuffer::Record(USize position, U32 size) noexcept
+{
+    auto  index  = this->m_flightCount.load(std::memory_order_relaxed);
+    auto &record = this->m_flightRecords[index % FLIGHT_RECORDS_COUNT];
+    auto  copied = size < FLIGHT_RECORD_SIZE ? size : (U32) FLIGHT_RECORD_SIZE;
+
+    // 読み込み側は前後の番号が一致する場合のみ記録を使用します
+    record.index.store(FLIGHT_RECORD_INVALID, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->Load(position, record.data, copied);
+    std::memcpy(&record.data[offsetof(LogRecordHeader, size)], &copied, sizeof(copied));
+    record.index.store(index, std::memory_order_release);
+    this->m_flightCount.store(index + 1, std::memory_order_release);
+}
+
+// 出力先へ書き込みます。
+// pData 文字の並びです。
+// size 文字数です。
+void WriteLogSinks(const void *pData, USize size)
+{
+    std::lock_guard<std::mutex> lock(g_logSinksMutexF);
+    for (USize i = 0; i < g_logSinksCount; i++)
+        g_pLogSinks[i]->Write((const Char *) pData, size);
+}
+
+// 出力先の書き込んだ内容を確定します。
+void FlushLogSinks()
+{
+    std::lock_guard<std::mutex> lock(g_logSinksMutexF);
+    for (USize i = 0; i < g_logSinksCount; i++)
+        g_pLogSinks[i]->Flush();
+}
+
+// 行をまとめる領域です。
+// 行の区切りで残りが少なくなった場合、または、満杯になった場合、出力先へまとめて書き込みます。
+class LogLineBuffer
+{
+    static constexpr USize CAPACITY     = 64 * 1024; // 容量です。
+    static constexpr USize LINE_RESERVE = 8 * 1024;  // 行の区切りで残しておく容量です。
+    static constexpr USize NUMBER_MAX   = 32;        // 数値の最大の文字数です。
+
+    void (*m_pWrite)(const void *, USize); // 出力先へ書き込む関数です。
+    char        m_data[CAPACITY];          // まとめた文字の並びです。
+    USize       m_count;                   // 文字数です。
+    std::time_t m_cachedSecond;            // 最後にローカル時間へ変換した秒です。
+    tm          m_cachedLocalTime;         // 最後に変換したローカル時間です。
+    Bool        m_isLocalTime;             // 時間をローカル時間で出力するか判定します。
+
+    // 秒をローカル時間へ変換します。
+    // 同じ秒の変換は前回の結果を再利用します。
+    // second 秒です。
+    // 変換できた場合、ローカル時間です。失敗した場合、nullptrです。
+    const tm *_LocalTimeOf(std::time_t second)
+    {
+        if (second == this->m_cachedSecond)
+            return &this->m_cachedLocalTime;
+#if defined(_WIN32)
+        if (localtime_s(&this->m_cachedLocalTime, &second) != 0)
+            return nullptr;
+#else
+        if (localtime_r(&second, &this->m_cachedLocalTime) == nullptr)
+            return nullptr;
+#endif
+        this->m_cachedSecond = second;
+        return &this->m_cachedLocalTime;
+    }
+
+public:
+    // 初期化します。
+    // pWrite 出力先へ書き込む関数です。
+    // isLocalTime 時間をローカル時間で出力するか判定します。偽の場合、UNIX時間の秒で出力します。
+    LogLineBuffer(void (*pWrite)(const void *, USize), Bool isLocalTime)
+        : m_pWrite(pWrite), m_count(0), m_cachedSecond(-1), m_isLocalTime(isLocalTime)
+    {}
+
+    // 出力先へ書き込みます。
+    void Flush()
+    {
+        if (this->m_count == 0)
+            return;
+        this->m_pWrite(this->m_data, this->m_count);
+        this->m_count = 0;
+    }
+
+    // 行を区切ります。
+    // 残りが少ない場合、行の途中で分割しないよう出力先へ書き込みます。
+    void EndLine()
+    {
+        this->Append('\n');
+        if (CAPACITY - this->m_count < LINE_RESERVE)
+            this->Flush();
+    }
+
+    // 文字を追加します。
+    // c 文字です。
+    void Append(char c)
+    {
+        if (this->m_count == CAPACITY)
+            this->Flush();
+        this->m_data[this->m_count++] = c;
+    }
+
+    // 文字の並びを追加します。
+    // pData 文字の並びです。
+    // size 文字数です。
+    void Append(const void *pData, USize size)
+    {
+        if (CAPACITY - this->m_count < size)
+        {
+            this->Flush();
+            if (CAPACITY < size)
+            {
+                this->m_pWrite(pData, size);
+                return;
+            }
+        }
+        std::memcpy(&this->m_data[this->m_count], pData, size);
+        this->m_count += size;
+    }
+
+    // 文字列を追加します。
+    // text 文字列です。
+    void Append(const Char *text)
+    {
+        this->Append(text, std::strlen((const char *) text));
+    }
+
+    // 0埋めの数値を追加します。
+    // value 数値です。
+    // digits 桁数です。
+    void AppendDigits(U32 value, USize digits)
+    {
+        char text[10];
+        for (auto i = digits; i > 0; i--)
+        {
+            text[i - 1] = (char) ('0' + value % 10);
+            value /= 10;
+        }
+        this->Append(text, digits);
+    }
+
+    // 記録した時間を追加します。
+    // time 記録した時間です。(単調増加する時計のナノ秒)
+    void AppendTime(U64 time)
+    {
+        auto systemTime = g_logBaseSystemTime
+                          + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                              std::chrono::nanoseconds((I64) (time - g_logBaseTime)));
+        auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+                                systemTime.time_since_epoch())
+                                .count();
+        auto second   = (std::time_t) (microseconds / 1000000);
+        auto fraction = (U32) (microseconds % 1000000);
+
+        // ローカル時間への変換は非同期シグナル安全ではありません
+        if (!this->m_isLocalTime)
+        {
+            this->Append(TXT("[ "));
+            this->AppendNumber((I64) second);
+            this->Append('.');
+            this->AppendDigits(fraction, 6);
+            this->Append(TXT(" ] "));
+            return;
+        }
+
+        auto pLocalTime = this->_LocalTimeOf(second); // ローカル時間に変換
+        if (pLocalTime == nullptr)
+        {
+            this->Append(TXT("[ \?\?/\?\? - \?\?:\?\?:\?\?.\?\?\?\?\?\? ] "));
+            return;
+        }
+        this->Append(TXT("[ "));
+        this->AppendDigits((U32) pLocalTime->tm_mon + 1, 2);
+        this->Append('/');
+        this->AppendDigits((U32) pLocalTime->tm_mday, 2);
+        this->Append(TXT(" - "));
+        this->AppendDigits((U32) pLocalTime->tm_hour, 2);
+        this->Append(':');
+        this->AppendDigits((U32) pLocalTime->tm_min, 2);
+        this->Append(':');
+        this->AppendDigits((U32) pLocalTime->tm_sec, 2);
+        this->Append('.');
+        this->AppendDigits(fraction, 6);
+        this->Append(TXT(" ] "));
+    }
+
+    // 数値を追加します。ロケールに依存しません。
+    // value 数値です。
+    template<typename T>
+    void AppendNumber(T value)
+    {
+        if (CAPACITY - this->m_count < NUMBER_MAX)
+            this->Flush();
+        auto result = std::to_chars(&this->m_data[this->m_count],
+                                    &this->m_data[CAPACITY],
+                                    value);
+        this->m_count = (USize) (result.ptr - this->m_data);
+    }
+
+    // 16進数の数値を追加します。
+    // value 数値です。
+    void AppendHex(U64 value)
+    {
+        if (CAPACITY - this->m_count < NUMBER_MAX)
+            this->Flush();
+        auto result = std::to_chars(&this->m_data[this->m_count],
+                                    &this->m_data[CAPACITY],
+                                    value,
+                                    16);
+        this->m_count = (USize) (result.ptr - this->m_data);
+    }
+};
+LogLineBuffer g_logLine(WriteLogSinks, true); // 書き込みスレッドが行を組み立てる領域です。
+
+// 書式化した記録を追加します。
+// 引数が不足する場合、'{}'をそのまま出力します。切り詰められた引数は不足として扱います。
+// line 追加先です。
+// format 書式です。
+// pArguments 引数の並びです。
+// size 引数の並びのサイズです。
+void AppendLogFormat(LogLineBuffer &line,
+                     const Char    *format,
+                     const U8      *pArguments,
+                     USize          size)
+{
+    auto position = (USize) 0;
+    for (auto p = format; *p != '\0'; p++)
+    {
+        if ((p[0] == '{' && p[1] == '{') || (p[0] == '}' && p[1] == '}'))
+        {
+            line.Append((char) *p++);
+            continue;
+        }
+        if (p[0] != '{' || p[1] != '}')
+        {
+            line.Append((char) *p);
+            continue;
+        }
+        p++;
+
+        // 値のサイズを確認します
+        auto valueSize = size; // 不明な種類は残りを超える値として扱います
+        auto type      = position < size ? (ELogArgument) pArguments[position] : ELogArgument::BOOL;
+        switch (type)
+        {
+        case ELogArgument::BOOL:
+        case ELogArgument::CHAR:
+            valueSize = sizeof(U8);
+            break;
+        case ELogArgument::SIGNED:
+        case ELogArgument::UNSIGNED:
+        case ELogArgument::FLOAT:
+            valueSize = sizeof(U64);
+            break;
+        case ELogArgument::STRING:
+            valueSize = sizeof(U32);
+            break;
+        case ELogArgument::POINTER:
+            valueSize = sizeof(USize);
+            break;
+        }
+        if (position >= size || valueSize > size - position - 1)
+        {
+            line.Append("{}", 2);
+            position = size;
+            continue;
+        }
+        auto pValue = &pArguments[++position];
+        switch (type)
+        {
+        case ELogArgument::BOOL:
+            if (*pValue != 0)
+                line.Append("true", 4);
+            else
+                line.Append("false", 5);
+            position += sizeof(U8);
+            break;
+        case ELogArgument::SIGNED:
+        {
+            I64 value;
+            std::memcpy(&value, pValue, sizeof(value));
+            line.AppendNumber(value);
+            position += sizeof(value);
+            break;
+        }
+        case ELogArgument::UNSIGNED:
+        {
+            U64 value;
+            std::memcpy(&value, pValue, sizeof(value));
+            line.AppendNumber(value);
+            position += sizeof(value);
+            break;
+        }
+        case ELogArgument::FLOAT:
+        {
+            F64 value;
+            std::memcpy(&value, pValue, sizeof(value));
+            line.AppendNumber(value);
+            position += sizeof(value);
+            break;
+        }
+        case ELogArgument::CHAR:
+            line.Append((char) *pValue);
+            position += sizeof(U8);
+            break;
+        case ELogArgument::STRING:
+        {
+            U32 length;
+            std::memcpy(&length, pValue, sizeof(length));
+            position += sizeof(length);
+            if (length > size - position) // 切り詰められた文字列
+                length = (U32) (size - position);
+            line.Append(pValue + sizeof(length), length);
+            position += length;
+            break;
+        }
+        case ELogArgument::POINTER:
+        {
+            USize value;
+            std::memcpy(&value, pValue, sizeof(value));
+            line.Append("0x", 2);
+            line.AppendHex(value);
+            position += sizeof(value);
+            break;
+        }
+        }
+    }
+}
+
+// 記録を1行追加します。
+// line 追加先です。
+// header 記録の先頭の情報です。
+// pData 本文です。
+// size 本文のサイズです。
+void AppendLogRecord(LogLineBuffer         &line,
+                     const LogRecordHeader &header,
+                     const U8              *pData,
+                     USize                  size)
+{
+    line.AppendTime(header.time);
+    line.Append(header.pLabel);
+    if (header.pCategory != nullptr && header.pCategory != &DefaultLogCategory())
+    {
+        line.Append(' ');
+        line.Append(header.pCategory->Name());
+    }
+    line.Append(TXT(" : "));
+    if (header.pFormat == nullptr)
+        line.Append(pData, size);
+    else
+        AppendLogFormat(line, header.pFormat, pData, size);
+    line.EndLine();
+}
+
+// 最後に出力した記録と同じか判定します。
+// header 記録の先頭の情報です。
+// pData 本文です。
+// size 本文のサイズです。
+// 同じ場合、真です。
+Bool IsLogRecordRepeated(const LogRecordHeader &header, const U8 *pData, USize size)
+{
+    auto &last = g_logLastRecordHeader;
+    return header.size == last.size && header.pLabel == last.pLabel
+        && header.pFormat == last.pFormat && header.pCategory == last.pCategory
+        && std::memcmp(pData, g_pLogLastRecordData, size) == 0;
+}
+
+// 省略した記録の回数を追加します。
+void AppendLogRepeated()
+{
+    if (g_logRepeatedCount == 0)
+        return;
+    auto &last = g_logLastRecordHeader;
+    g_logLine.AppendTime(last.time);
+    g_logLine.Append(last.pLabel);
+    if (last.pCategory != nullptr && last.pCategory != &DefaultLogCategory())
+    {
+        g_logLine.Append(' ');
+        g_logLine.Append(last.pCategory->Name());
+    }
+    g_logLine.Append(TXT(" : Previous message repeated "));
+    g_logLine.AppendNumber(g_logRepeatedCount);
+    g_logLine.Append(TXT(" times."));
+    g_logLine.EndLine();
+    g_logRepeatedCount = 0;
+}
+
+// バッファの記録を出力先へ書き込みます。
+// 各バッファの確定済みの記録を、記録した時間の順に併合して書き込みます。
+// 直前と同じ記録は省略し、異なる記録の前、一定時間の経過時、または、書き込みの要求時に省略した回数を書き込みます。
+// isFlushing 書き込みが要求されているか判定します。
+// 記録を読み込んだ場合、真です。
+Bool DrainLogBuffers(Bool isFlushing)
+{
+    // 破棄した回数は読み込む記録に含めます
+    FlushLogRateLimiters(isFlushing);
+
+    auto pBuffers = g_pLogBuffers.load(std::memory_order_acquire);
+    for (auto pBuffer = pBuffers; pBuffer != nullptr; pBuffer = pBuffer->m_pNext)
+    {
+        pBuffer->m_drainHead = pBuffer->m_head.load(std::memory_order_relaxed);
+        pBuffer->m_drainTail = pBuffer->m_tail.load(std::memory_order_acquire);
+    }
+
+    auto isRead    = false;
+    auto isWritten = false;
+    while (true)
+    {
+        // 最も古い記録を持つバッファを探します
+        LogBuffer *pOldest = nullptr;
+        U64        oldest  = 0;
+        for (auto pBuffer = pBuffers; pBuffer != nullptr; pBuffer = pBuffer->m_pNext)
+        {
+            if (pBuffer->m_drainHead == pBuffer->m_drainTail)
+                continue;
+            U64 time;
+            pBuffer->Load(pBuffer->m_drainHead + offsetof(LogRecordHeader, time),
+                          &time,
+                          sizeof(time));
+            if (pOldest == nullptr || time < oldest)
+            {
+                pOldest = pBuffer;
+                oldest  = time;
+            }
+        }
+        if (pOldest == nullptr)
+            break;
+
+        LogRecordHeader header;
+        pOldest->Load(pOldest->m_drainHead, &header, sizeof(header));
+        auto size = header.size - sizeof(header);
+        pOldest->Load(pOldest->m_drainHead + sizeof(header), g_pLogRecordData, size);
+        pOldest->m_drainHead += header.size;
+        pOldest->m_drainCount++;
+        if (pOldest->m_drainHead == pOldest->m_drainTail)
+        {
+            pOldest->m_head.store(pOldest->m_drainHead, std::memory_order_release);
+            pOldest->m_isNotifiedF.store(false, std::memory_order_relaxed);
+        }
+        isRead = true;
+
+        if (IsLogRecordRepeated(header, g_pLogRecordData, size))
+        {
+            if (g_logRepeatedCount++ == 0)
+                g_logRepeatedTime = header.time;
+            g_logLastRecordHeader.time = header.time;
+            continue;
+        }
+        AppendLogRepeated();
+        AppendLogRecord(g_logLine, header, g_pLogRecordData, size);
+        g_logLastRecordHeader = header;
+        std::swap(g_pLogRecordData, g_pLogLastRecordData);
+        isWritten = true;
+    }
+    if (g_logRepeatedCount != 0
+        && (isFlushing
+            || NowLogTime() - g_logRepeatedTime
+                   >= (U64) std::chrono::nanoseconds(LOG_REPEAT_INTERVAL).count()))
+    {
+        AppendLogRepeated();
+        isWritten = true;
+    }
+    if (isWritten)
+    {
+        g_logLine.Flush();
+        FlushLogSinks(); // 書き込み
+    }
+    for (auto pBuffer = pBuffers; pBuffer != nullptr; pBuffer = pBuffer->m_pNext)
+        pBuffer->m_writtenCount = pBuffer->m_drainCount;
+    return isRead;
+}
+
+// 書き込みスレッドの処理です。
+void RunLogWriter()
+{
+    t_isLogWriterF = true;
+    while (true)
+    {
+        auto isRunning = g_isLogSystemRunningF.load(std::memory_order_acquire);
+        auto requested = g_logFlushRequestedCount.load(std::memory_order_acquire);
+        auto isRead    = DrainLogBuffers(!isRunning || g_logFlushedCount < requested);
+
+        std::unique_lock<std::mutex> lock(g_logWriterMutexF);
+        if (g_logFlushedCount < requested)
+        {
+            g_logFlushedCount = requested;
+            g_logFlushedCondition.notify_all();
+        }
+        if (!isRunning)
+            break;
+        if (!isRead
+            && requested == g_logFlushRequestedCount.load(std::memory_order_relaxed))
+            g_logWriterCondition.wait_for(lock, LOG_WRITER_INTERVAL);
+    }
+}
+
 // ログシステムを解体します。
 void FinalizeLogSystem()
 {
-    fclose(g_pFile);
+    // 停止後は記録できないため、破棄した回数を先に記録します
+    FlushLogRateLimiters(true);
+    {
+        std::lock_guard<std::mutex> lock(g_logWriterMutexF);
+        g_isLogSystemRunningF.store(false, std::memory_order_release);
+        g_logWriterCondition.notify_one();
+        g_logFlushedCondition.notify_all();
+    }
+    // 出力先から異常終了した場合、自身を待機できません
+    if (std::this_thread::get_id() == g_logWriter.get_id())
+        g_logWriter.detach();
+    else
+        g_logWriter.join();
+}
+
+// フライトレコーダーの出力を書き込みます。
+// 出力先を使用できない場合、標準エラー出力へ書き込みます。
+// 出力先から異常終了した可能性があるため、書き込みスレッドでは出力先を使用しません。
+// pData 文字の並びです。
+// size 文字数です。
+void WriteLogDump(const void *pData, USize size)
+{
+    if (!t_isLogWriterF)
+    {
+        for (auto i = 0; i < LOG_DUMP_LOCK_ATTEMPTS; i++)
+        {
+            if (g_logSinksMutexF.try_lock())
+            {
+                for (USize j = 0; j < g_logSinksCount; j++)
+                {
+                    g_pLogSinks[j]->Write((const Char *) pData, size);
+                    g_pLogSinks[j]->Flush();
+                }
+                g_logSinksMutexF.unlock();
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+    std::fwrite(pData, 1, size, stderr);
+    std::fflush(stderr);
 }
+LogLineBuffer g_logDumpLine(WriteLogDump, true); // フライトレコーダーの出力で行を組み立てる領域です。
+
+// シグナルハンドラからフライトレコーダーの出力を書き込みます。
+// 非同期シグナル安全な関数のみで、標準エラー出力へ直接書き込みます。
+// pData 文字の並びです。
+// size 文字数です。
+void WriteLogSignal(const void *pData, USize size)
+{
+    auto pText = (const char *) pData;
+    while (size > 0)
+    {
+#if defined(_WIN32)
+        auto written = _write(2, pText, (unsigned int) size);
+#else
+        auto written = write(STDERR_FILENO, pText, size);
+#endif
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return;
+        pText += written;
+        size -= (USize) written;
+    }
+}
+LogLineBuffer g_logSignalLine(WriteLogSignal, false); // シグナルハンドラで行を組み立てる領域です。
+
+// 各スレッドのフライトレコーダーの記録を出力します。
+// 他のスレッドが出力中の場合、何もしません。
+// line 出力先です。
+// reason 出力する理由です。
+// isUnwrittenOnly 書き込みスレッドが出力先へ書き込んでいない記録のみを出力するか判定します。書き込みスレッドのみ真にできます。
+void DumpLogFlightRecords(LogLineBuffer &line, const Char *reason, Bool isUnwrittenOnly)
+{
+    auto pBuffers = g_pLogBuffers.load(std::memory_order_acquire);
+    auto isDumping = false;
+    if (pBuffers == nullptr
+        || !g_isLogDumpingF.compare_exchange_strong(isDumping, true, std::memory_order_acquire))
+        return;
+
+    line.Append(TXT("---- Flight recorder : "));
+    line.Append(reason);
+    line.Append(TXT(" ----"));
+    line.EndLine();
+    auto number = (USize) 0;
+    for (auto pBuffer = pBuffers; pBuffer != nullptr; pBuffer = pBuffer->m_pNext)
+    {
+        line.Append(TXT("-- Thread buffer "));
+        line.AppendNumber(number++);
+        if (pBuffer == t_pLogBuffer)
+            line.Append(TXT(" (current thread)"));
+        line.Append(TXT(" --"));
+        line.EndLine();
+
+        auto count = pBuffer->m_flightCount.load(std::memory_order_acquire);
+        auto first = count > LogBuffer::FLIGHT_RECORDS_COUNT
+                         ? count - LogBuffer::FLIGHT_RECORDS_COUNT
+                         : 0;
+        if (isUnwrittenOnly && first < pBuffer->m_writtenCount)
+            first = pBuffer->m_writtenCount;
+        for (auto index = first; index < count; index++)
+        {
+            // 書き込み中に読み込んだ記録は破棄します
+            auto &record = pBuffer->m_flightRecords[index % LogBuffer::FLIGHT_RECORDS_COUNT];
+            if (record.index.load(std::memory_order_acquire) != index)
+                continue;
+            std::memcpy(g_logDumpRecordData, record.data, LogBuffer::FLIGHT_RECORD_SIZE);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (record.index.load(std::memory_order_relaxed) != index)
+                continue;
+
+            LogRecordHeader header;
+            std::memcpy(&header, g_logDumpRecordData, sizeof(header));
+            if (header.size < sizeof(header) || header.size > LogBuffer::FLIGHT_RECORD_SIZE)
+                continue;
+            AppendLogRecord(line,
+                            header,
+                            g_logDumpRecordData + sizeof(header),
+                            header.size - sizeof(header));
+        }
+    }
+    line.Append(TXT("---- End of flight recorder ----"));
+    line.EndLine();
+    line.Flush();
+    g_isLogDumpingF.store(false, std::memory_order_release);
+}
+
+// フライトレコーダーを出力する致命的なシグナルです。
+const int LOG_FATAL_SIGNALS[] = {
+    SIGABRT,
+    SIGFPE,
+    SIGILL,
+    SIGSEGV,
+#if defined(SIGBUS)
+    SIGBUS,
+#endif
+};
+// 致命的なシグナルの名前です。
+const Char *LOG_FATAL_SIGNAL_NAMES[] = {
+    TXT("SIGABRT"),
+    TXT("SIGFPE"),
+    TXT("SIGILL"),
+    TXT("SIGSEGV"),
+#if defined(SIGBUS)
+    TXT("SIGBUS"),
+#endif
+};
+constexpr USize LOG_FATAL_SIGNALS_COUNT = sizeof(LOG_FATAL_SIGNALS) / sizeof(int); // 致命的なシグナルの数です。
+#if defined(_WIN32)
+void (*g_pPreviousSignalHandlers[LOG_FATAL_SIGNALS_COUNT])(int); // 以前のシグナルハンドラです。
+#else
+struct sigaction g_previousSignalActions[LOG_FATAL_SIGNALS_COUNT]; // 以前のシグナルの処理です。
+#endif
+
+// 致命的なシグナルを処理します。
+// フライトレコーダーを標準エラー出力へ出力し、以前のシグナルハンドラへ引き継ぎます。
+// 非同期シグナル安全でない出力先、ロック、ローカル時間への変換は使用しません。
+// signal シグナルです。
+void HandleLogFatalSignal(int signal)
+{
+    auto name = TXT("Signal");
+    for (USize i = 0; i < LOG_FATAL_SIGNALS_COUNT; i++)
+    {
+        if (LOG_FATAL_SIGNALS[i] != signal)
+            continue;
+        name = LOG_FATAL_SIGNAL_NAMES[i];
+#if defined(_WIN32)
+        auto pHandler = g_pPreviousSignalHandlers[i];
+        if (pHandler == SIG_ERR || pHandler == SIG_IGN || pHandler == nullptr)
+            pHandler = SIG_DFL;
+        std::signal(signal, pHandler);
+#else
+        // 無視すると同じ命令で再び発生し続けるため、既定の処理にします
+        auto action = g_previousSignalActions[i];
+        if ((action.sa_flags & SA_SIGINFO) == 0 && action.sa_handler == SIG_IGN)
+            action.sa_handler = SIG_DFL;
+        sigaction(signal, &action, nullptr);
+#endif
+    }
+    DumpLogFlightRecords(g_logSignalLine, name, false);
+    std::raise(signal);
+}
+
 // ログシステムを初期化します。
+// 出力先が追加されていない場合、既定のファイルへ出力します。
 void InitializeLogSystem()
 {
-    if (fopen_s(&g_pFile, LOG_FILE_NAME, "w") != 0)
     {
-        std::cerr << "Failed to create or open the file "
-                  << LOG_FILE_NAME << "." << std::endl;
+        std::lock_guard<std::mutex> lock(g_logSinksMutexF);
+        if (g_logSinksCount == 0)
+        {
+            static FileLogSink defaultSink(LOG_FILE_NAME);
+            g_pLogSinks[g_logSinksCount++] = &defaultSink;
+        }
     }
-    else
+
+    CalibrateLogTime();
+    g_isLogSystemRunningF.store(true, std::memory_order_release);
+    g_logWriter = std::thread(RunLogWriter);
+    std::atexit(FinalizeLogSystem);
+
+    // 異常終了時にフライトレコーダーを出力します
+#if defined(_WIN32)
+    for (USize i = 0; i < LOG_FATAL_SIGNALS_COUNT; i++)
+        g_pPreviousSignalHandlers[i] = std::signal(LOG_FATAL_SIGNALS[i], HandleLogFatalSignal);
+#else
+    // スタックの溢れでも処理できるよう、代替スタックで処理します
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = HandleLogFatalSignal;
+    action.sa_flags   = SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+    for (USize i = 0; i < LOG_FATAL_SIGNALS_COUNT; i++)
+        sigaction(LOG_FATAL_SIGNALS[i], &action, &g_previousSignalActions[i]);
+#endif
+}
+
+// --------------------
+//
+// ログの出力先
+//
+// ====================
+
+// ログの出力先を追加します。
+// ログシステムの初期化前に1つも追加しない場合、'Log.txt'へ出力するFileLogSinkを使用します。
+// pSink 出力先です。
+// 出力先はRemoveLogSinkで取り除くか、プログラムの終了まで存在する必要があります。
+// 出力先の数がLOG_SINKS_MAXを超えた場合、異常終了します。
+void FuraiEngine::AddLogSink(LogSink *pSink) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(g_logSinksMutexF);
+        if (g_logSinksCount < LOG_SINKS_MAX)
+        {
+            g_pLogSinks[g_logSinksCount++] = pSink;
+            return;
+        }
+    }
+
+    LogError(TXT("登録できる出力先の数を超えました。"
+                 "'void AddLogSink(LogSink *pSink) noexcept'"));
+
+    ExitError();
+}
+
+// ログの出力先を取り除きます。
+// 戻った後、出力先は書き込みスレッドから呼び出されません。
+// pSink 出力先です。
+void FuraiEngine::RemoveLogSink(LogSink *pSink) noexcept
+{
+    std::lock_guard<std::mutex> lock(g_logSinksMutexF);
+    for (USize i = 0; i < g_logSinksCount; i++)
     {
-        std::atexit(FinalizeLogSystem);
+        if (g_pLogSinks[i] == pSink)
+        {
+            for (; i + 1 < g_logSinksCount; i++)
+                g_pLogSinks[i] = g_pLogSinks[i + 1];
+            g_logSinksCount--;
+            return;
+        }
+    }
+}
+
+// --------------------
+//
+// LogCategory
+//
+// ====================
+
+std::atomic<LogCategory *> g_pLogCategories(nullptr); // 登録されたカテゴリの単方向連結リストの先頭です。
+
+// 初期化し、登録します。
+// name 名前です。静的な文字列である必要があります。
+// level 出力する最小の重要度です。
+FuraiEngine::LogCategory::LogCategory(const Char *name,
+                                      ELogLevel   level) noexcept
+    : m_pName(name), m_level(level), m_pNext(nullptr)
+{
+    this->m_pNext = g_pLogCategories.load(std::memory_order_relaxed);
+    while (!g_pLogCategories.compare_exchange_weak(
+        this->m_pNext, this, std::memory_order_release))
+    {}
+}
+
+// 既定のログカテゴリを取得します。
+// カテゴリを指定しないLog、LogWarning、LogErrorはこのカテゴリで出力します。
+// 既定のログカテゴリです。
+LogCategory &FuraiEngine::DefaultLogCategory() noexcept
+{
+    static LogCategory category(TXT("Default"));
+    return category;
+}
+
+// 名前が一致するカテゴリの出力する最小の重要度を設定します。
+// name カテゴリの名前です。
+// level 出力する最小の重要度です。
+// カテゴリが見つかった場合、真です。
+Bool FuraiEngine::SetLogLevel(const Char *name, ELogLevel level) noexcept
+{
+    auto isFound = false;
+    for (auto pCategory = g_pLogCategories.load(std::memory_order_acquire);
+         pCategory != nullptr;
+         pCategory = pCategory->m_pNext)
+    {
+        if (std::strcmp((const char *) pCategory->Name(), (const char *) name) == 0)
+        {
+            pCategory->SetLevel(level);
+            isFound = true;
+        }
+    }
+    return isFound;
+}
+
+// --------------------
+//
+// LogRateLimiter
+//
+// ====================
+
+// 出力できるか判定します。
+// 破棄した出力がある場合、出力を再開する前に破棄した回数を出力します。
+// level 破棄した回数を出力する重要度です。
+// category 破棄した回数を出力するカテゴリです。
+// 出力できる場合、真です。
+Bool FuraiEngine::LogRateLimiter::TryAcquire(ELogLevel          level,
+                                             const LogCategory &category) noexcept
+{
+    // 秒が変わった場合、回数を数え直します
+    auto second  = NowLogTime() / 1000000000;
+    auto current = this->m_second.load(std::memory_order_relaxed);
+    if (second != current
+        && this->m_second.compare_exchange_strong(current, second, std::memory_order_relaxed))
+        this->m_count.store(0, std::memory_order_relaxed);
+
+    if (this->m_count.fetch_add(1, std::memory_order_relaxed) >= this->m_countPerSecond)
+    {
+        this->m_level.store(level, std::memory_order_relaxed);
+        this->m_pCategory.store(&category, std::memory_order_relaxed);
+        this->m_suppressedCount.fetch_add(1, std::memory_order_release);
+
+        // 出力が続かなくても書き込みスレッドが回数を出力できるよう登録します
+        if (!this->m_isRegisteredF.load(std::memory_order_relaxed)
+            && !this->m_isRegisteredF.exchange(true, std::memory_order_relaxed))
+        {
+            this->m_pNext = g_pLogRateLimiters.load(std::memory_order_relaxed);
+            while (!g_pLogRateLimiters.compare_exchange_weak(
+                this->m_pNext, this, std::memory_order_release))
+            {}
+        }
+        return false;
+    }
+    if (this->m_suppressedCount.load(std::memory_order_relaxed) != 0)
+    {
+        auto suppressedCount = this->m_suppressedCount.exchange(0, std::memory_order_relaxed);
+        if (suppressedCount != 0)
+            LogAt(level, category, TXT("{} messages were suppressed by the rate limit."), suppressedCount);
+    }
+    return true;
+}
+
+// 破棄した回数が残っているログの出力制限について、回数を出力します。
+// 書き込みスレッドが記録を読み込む前に呼び出します。
+// isFlushing 書き込みが要求されている場合、秒が変わる前でも出力します。
+void FuraiEngine::_Internal::FlushLogRateLimiters(Bool isFlushing) noexcept
+{
+    auto second = NowLogTime() / 1000000000;
+    for (auto pLimiter = g_pLogRateLimiters.load(std::memory_order_acquire); pLimiter != nullptr;
+         pLimiter      = pLimiter->m_pNext)
+    {
+        if (pLimiter->m_suppressedCount.load(std::memory_order_relaxed) == 0
+            || (!isFlushing && pLimiter->m_second.load(std::memory_order_relaxed) == second))
+            continue;
+        auto suppressedCount = pLimiter->m_suppressedCount.exchange(0, std::memory_order_acquire);
+        if (suppressedCount != 0)
+            LogAt(pLimiter->m_level.load(std::memory_order_relaxed),
+                  *pLimiter->m_pCategory.load(std::memory_order_relaxed),
+                  TXT("{} messages were suppressed by the rate limit."),
+                  suppressedCount);
     }
 }
 
@@ -48,49 +1200,82 @@ void InitializeLogSystem()
 
 // 初期化します。
 // label メッセージのカテゴリラベルです。
-// 同スレッド内でインスタンス解放前にもう1つインスタンス化するとデッドロックが発生します。
-FuraiEngine::_Internal::Logger::Logger(const Char *label) noexcept
+// format 書式です。nullptrの場合、メッセージをそのまま出力します。
+// pCategory カテゴリです。nullptrの場合、既定のカテゴリです。
+// 同スレッド内でインスタンス解放前にもう1つインスタンス化した場合、後のインスタンスの記録は破棄されます。
+// formatは静的な文字列である必要があります。書式化は書き込みスレッドで行います。
+FuraiEngine::_Internal::Logger::Logger(const Char        *label,
+                                       const Char        *format,
+                                       const LogCategory *pCategory) noexcept
+    : m_pBuffer(nullptr), m_begin(0), m_end(0)
 {
     std::call_once(g_initializeLogSystemOnceF, InitializeLogSystem);
-    if (g_pFile == nullptr)
+    if (!g_isLogSystemRunningF.load(std::memory_order_relaxed) || t_isLoggingF)
         return;
 
-    g_logMutexF.lock(); // 占有ロック
-    __time64_t longTime;
-    _time64(&longTime); // 時間を取得
-    tm localTime;
-    if (_localtime64_s(&localTime, &longTime) != 0) // ローカル時間に変換
-    {
-        fprintf(g_pFile, TXT("[ \?\?/\?\? - \?\?:\?\?:\?\? ] %s : "), label);
-    }
-    else
-    {
-        fprintf( // 内容を設定
-            g_pFile,
-            TXT("[ %02d/%02d - %02d:%02d:%02d ] %s : "),
-            localTime.tm_mon + 1,
-            localTime.tm_mday,
-            localTime.tm_hour,
-            localTime.tm_min,
-            localTime.tm_sec,
-            label);
-    }
+    auto pBuffer = AcquireLogBuffer();
+    if (pBuffer == nullptr)
+        return;
+
+    LogRecordHeader header;
+    header.size      = 0;
+    header.pLabel    = label;
+    header.pFormat   = format;
+    header.pCategory = pCategory;
+    header.time      = NowLogTime(); // 時間を取得
+
+    auto begin = pBuffer->m_tail.load(std::memory_order_relaxed);
+    if (!pBuffer->Reserve(begin + sizeof(header)))
+        return;
+    pBuffer->Store(begin, &header, sizeof(header));
+
+    t_isLoggingF    = true;
+    this->m_pBuffer = pBuffer;
+    this->m_begin   = begin;
+    this->m_end     = begin + sizeof(header);
 }
 
 // ムーブします。
 // origin ムーブ元です。
 FuraiEngine::_Internal::Logger::Logger(Logger &&origin) noexcept
-{}
+    : m_pBuffer(origin.m_pBuffer), m_begin(origin.m_begin), m_end(origin.m_end)
+{
+    origin.m_pBuffer = nullptr;
+}
 
 // 解体します。
+// 記録を確定し、書き込みスレッドへ渡します。
 FuraiEngine::_Internal::Logger::~Logger() noexcept
 {
-    if (g_pFile == nullptr)
+    if (this->m_pBuffer == nullptr)
         return;
 
-    fprintf(g_pFile, "%s", TXT("\n"));
-    fflush(g_pFile);      // 書き込み
-    g_logMutexF.unlock(); // 占有ロック解除
+    auto size = (U32) (this->m_end - this->m_begin);
+    this->m_pBuffer->Store(
+        this->m_begin + offsetof(LogRecordHeader, size), &size, sizeof(size));
+    this->m_pBuffer->Record(this->m_begin, size);
+    this->m_pBuffer->m_tail.store(this->m_end, std::memory_order_release); // 確定
+    t_isLoggingF = false;
+
+    // 半分を超えて溜まった場合のみ、書き込みスレッドを起こします
+    // 読み込み位置は空きを待つ時のみ更新されるため、古い場合は読み直して判定します
+    // 起こした後は書き込みスレッドが読み込むまで、再び起こしません
+    auto pBuffer = this->m_pBuffer;
+    if (this->m_end - pBuffer->m_cachedHead > LogBuffer::CAPACITY / 2
+        && !pBuffer->m_isNotifiedF.load(std::memory_order_relaxed))
+    {
+        pBuffer->m_cachedHead = pBuffer->m_head.load(std::memory_order_acquire);
+        if (this->m_end - pBuffer->m_cachedHead > LogBuffer::CAPACITY / 2
+            && !pBuffer->m_isNotifiedF.exchange(true, std::memory_order_relaxed))
+            NotifyLogWriter();
+    }
+}
+
+// 記録を破棄します。
+void FuraiEngine::_Internal::Logger::_Discard() noexcept
+{
+    this->m_pBuffer = nullptr;
+    t_isLoggingF    = false;
 }
 
 // メッセージを追加します。
@@ -98,8 +1283,59 @@ FuraiEngine::_Internal::Logger::~Logger() noexcept
 // 自身のインスタンスです。
 Logger &&FuraiEngine::_Internal::Logger::Write(const Char *message) noexcept
 {
-    if (g_pFile != nullptr)
-        fprintf(g_pFile, "%s", message);
+    if (this->m_pBuffer == nullptr)
+        return Move(*this);
+
+    // 容量を超える記録は切り詰めます
+    auto size = std::strlen((const char *) message);
+    auto rest = LogBuffer::CAPACITY - (this->m_end - this->m_begin);
+    if (size > rest)
+        size = rest;
+
+    if (!this->m_pBuffer->Reserve(this->m_end + size))
+    {
+        this->_Discard();
+        return Move(*this);
+    }
+    this->m_pBuffer->Store(this->m_end, message, size);
+    this->m_end += size;
+    return Move(*this);
+}
+
+// 書式化する引数を追加します。
+// 記録に収まらない場合、引数は破棄されます。
+// type 引数の種類です。
+// pValue 値です。
+// size 値のサイズです。
+// 自身のインスタンスです。
+Logger &&FuraiEngine::_Internal::Logger::WriteArgument(ELogArgument type,
+                                                       const void  *pValue,
+                                                       USize        size) noexcept
+{
+    if (this->m_pBuffer == nullptr)
+        return Move(*this);
+
+    // 文字列は長さを前置します
+    auto isString = type == ELogArgument::STRING;
+    auto length   = (U32) size;
+    auto total    = sizeof(type) + (isString ? sizeof(length) : 0) + size;
+    if (total > LogBuffer::CAPACITY - (this->m_end - this->m_begin))
+        return Move(*this);
+
+    if (!this->m_pBuffer->Reserve(this->m_end + total))
+    {
+        this->_Discard();
+        return Move(*this);
+    }
+    this->m_pBuffer->Store(this->m_end, &type, sizeof(type));
+    this->m_end += sizeof(type);
+    if (isString)
+    {
+        this->m_pBuffer->Store(this->m_end, &length, sizeof(length));
+        this->m_end += sizeof(length);
+    }
+    this->m_pBuffer->Store(this->m_end, pValue, size);
+    this->m_end += size;
     return Move(*this);
 }
 
@@ -113,19 +1349,120 @@ Logger &&FuraiEngine::_Internal::Logger::Write(const Char *message) noexcept
 //message 出力メッセージです。
 void FuraiEngine::Log(const Char *message) noexcept
 {
-    Logger(LOG_LABEL).Write(message);
+    if (ELogLevel::LOG >= LOG_LEVEL_MIN
+        && DefaultLogCategory().IsEnabled(ELogLevel::LOG))
+        Logger(LOG_LABEL).Write(message);
 }
 
 // 警告を出力します。
 // message 出力メッセージです。
 void FuraiEngine::LogWarning(const Char *message) noexcept
 {
-    Logger(WARNING_LABEL).Write(message);
+    if (ELogLevel::WARNING >= LOG_LEVEL_MIN
+        && DefaultLogCategory().IsEnabled(ELogLevel::WARNING))
+        Logger(WARNING_LABEL).Write(message);
 }
 
 // エラーを出力します。
 // message 出力メッセージです。
 void FuraiEngine::LogError(const Char *message) noexcept
 {
-    Logger(ERROR_LABEL).Write(message);
+    if (ELogLevel::ERROR >= LOG_LEVEL_MIN
+        && DefaultLogCategory().IsEnabled(ELogLevel::ERROR))
+        Logger(ERROR_LABEL).Write(message);
+}
+
+// 出力済みのログがファイルへ書き込まれるまで待機します。
+void FuraiEngine::FlushLog() noexcept
+{
+    if (!g_isLogSystemRunningF.load(std::memory_order_acquire))
+        return;
+
+    std::unique_lock<std::mutex> lock(g_logWriterMutexF);
+    auto requested = g_logFlushRequestedCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+    g_logWriterCondition.notify_one();
+    g_logFlushedCondition.wait(lock, [requested]() {
+        return g_logFlushedCount >= requested
+            || !g_isLogSystemRunningF.load(std::memory_order_relaxed);
+    });
+}
+
+// 各スレッドの最新のログの記録を出力先へ出力します。
+// 記録は既に出力したものも含め、スレッドごとに最大64件です。
+void FuraiEngine::DumpLogFlightRecorder() noexcept
+{
+    DumpLogFlightRecords(g_logDumpLine, TXT("Requested"), false);
+}
+
+// 異常終了します。
+// 記録済みのログは終了時に書き込みスレッドが出力先へ書き込みます。
+// 書き込みスレッドから呼び出した場合、出力先へ書き込んでいない記録をフライトレコーダーから標準エラー出力へ出力します。
+void FuraiEngine::ExitError() noexcept
+{
+    // 他のスレッドの記録は終了時に書き込みスレッドが書き込むため、重複して出力しません
+    if (t_isLogWriterF)
+        DumpLogFlightRecords(g_logDumpLine, TXT("ExitError"), true);
+    std::exit(-1);
+}
+
+// --------------------
+//
+// 境界検査
+//
+// ====================
+
+// 範囲外へのアクセスを出力し、異常終了します。
+// index アクセスした位置です。
+// count 要素数です。
+// signature アクセスした関数のシグネチャです。
+void FuraiEngine::_Internal::ExitOutOfRange(USize       index,
+                                            USize       count,
+                                            const Char *signature) noexcept
+{
+    LogError(TXT("範囲外にアクセスしました。index: {}, count: {} '{}'"),
+             index,
+             count,
+             signature);
+
+    ExitError();
+}
+
+// 範囲外の部分領域の参照を出力し、異常終了します。
+// offset 部分領域の先頭の位置です。
+// count 部分領域の要素数です。
+// size 全体の要素数です。
+// signature 参照した関数のシグネチャです。
+void FuraiEngine::_Internal::ExitOutOfRange(USize       offset,
+                                            USize       count,
+                                            USize       size,
+                                            const Char *signature) noexcept
+{
+    LogError(TXT("範囲外を参照しました。offset: {}, count: {}, size: {} '{}'"),
+             offset,
+             count,
+             size,
+             signature);
+
+    ExitError();
+}
+
+// ヌルへのアクセスを出力し、異常終了します。
+// signature アクセスした関数のシグネチャです。
+void FuraiEngine::_Internal::ExitNullAccess(const Char *signature) noexcept
+{
+    LogError(TXT("参照先がnullでした。'{}'"), signature);
+
+    ExitError();
+}
+
+// 書式の誤りを出力し、異常終了します。
+// 定数式の評価中に呼び出された場合、コンパイルエラーになります。
+// format 書式です。
+void FuraiEngine::_Internal::ExitInvalidLogFormat(const Char *format) noexcept
+{
+    LogError(TXT("書式の'{{}}'の数が引数の数と一致しないか、"
+                 "対応しない'{{'、'}}'が含まれています。'{}'"),
+             format);
+
+    ExitError();
 }
\ No newline at end of file